@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+namespace vasp {
+namespace attack {
+
+// BSM fields an attack can change; a BSM's mutatedFields is a mask of these
+enum Field : unsigned int {
+    kFieldNone = 0,
+    kFieldPosition = 1u << 0,
+    kFieldSpeed = 1u << 1,
+    kFieldAcceleration = 1u << 2,
+    kFieldHeading = 1u << 3,
+    kFieldYawRate = 1u << 4,
+    kFieldLength = 1u << 5,
+    kFieldWidth = 1u << 6,
+    kFieldHardBraking = 1u << 7
+};
+
+} // namespace attack
+} // namespace vasp
@@ -28,6 +28,12 @@
 
 #pragma once
 
+#include <omnetpp/simtime_t.h>
+#include <vasp/attack/Field.h>
+#include <vasp/attack/Type.h>
+#include <veins/base/utils/Coord.h>
+#include <veins/base/utils/Heading.h>
+
 // forward declarations
 namespace veins {
 class BasicSafetyMessage;
@@ -35,9 +41,48 @@ class BasicSafetyMessage;
 
 namespace vasp {
 namespace attack {
+// vehicle targeted by a ghost vehicle attack, as of its latest BSM
+struct Target {
+    long address{-1};
+    veins::Coord position{};
+    veins::Coord speed{};
+    veins::Heading heading{0.0};
+};
+
+// attacker state handed to an attack before each BSM it modifies
+struct BeaconContext {
+    veins::Heading prevHeading{0.0}; // heading sent in the previous beacon
+    omnetpp::simtime_t prevBeaconTime{};
+    bool approachingIntersection{false};
+    veins::Coord junctionPos{};
+    veins::Coord hostSpeed{};
+    Target const* target{nullptr}; // target of ghost vehicle attacks
+};
+
+// attacks are created once per attacker and reused for every BSM
 class Interface {
 public:
+    virtual ~Interface() = default;
+    virtual void update(BeaconContext const& /* context */) {}
     virtual void attack(veins::BasicSafetyMessage* bsm) = 0;
+
+    // type the attacked BSMs are labelled with, set by attack::create()
+    void setAttackType(Type const type)
+    {
+        attackType_ = type;
+    }
+
+    Type getAttackType() const
+    {
+        return attackType_;
+    }
+
+protected:
+    // labels bsm with the attack type and adds fields to its mutated fields
+    void markAttacked(veins::BasicSafetyMessage* bsm, unsigned int const fields) const;
+
+private:
+    Type attackType_{kAttackNo};
 };
 } // namespace attack
 } // namespace vasp
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <vasp/attack/Pipeline.h>
+#include <vasp/messages/BasicSafetyMessage_m.h>
+
+namespace vasp {
+namespace attack {
+
+void Pipeline::addStage(std::unique_ptr<Interface> stage)
+{
+    stages_.push_back(std::move(stage));
+}
+
+void Pipeline::update(BeaconContext const& context)
+{
+    for (auto& stage : stages_) {
+        stage->update(context);
+    }
+}
+
+void Pipeline::attack(veins::BasicSafetyMessage* bsm)
+{
+    bsm->setAttackStagesArraySize(stages_.size());
+    unsigned int nApplied{0};
+    for (auto& stage : stages_) {
+        // a stage may leave the BSM alone, e.g. IMA attacks away from intersections
+        bsm->setAttackType(kAttackNo);
+        stage->attack(bsm);
+        if (bsm->getAttackType() != kAttackNo) {
+            bsm->setAttackStages(nApplied++, stage->getAttackType());
+        }
+    }
+    bsm->setAttackStagesArraySize(nApplied);
+
+    if (nApplied > 0) {
+        markAttacked(bsm, kFieldNone);
+    }
+}
+
+} // namespace attack
+} // namespace vasp
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <vasp/attack/Interface.h>
+
+namespace vasp {
+namespace attack {
+// Applies an ordered list of attacks to a BSM in a single pass. The BSM is
+// labelled kAttackPipeline with the types of the stages that changed it, and
+// the fields mutated by all of them.
+class Pipeline final : public Interface {
+public:
+    void addStage(std::unique_ptr<Interface> stage);
+    bool empty() const
+    {
+        return stages_.empty();
+    }
+
+    void update(BeaconContext const& context) override;
+    void attack(veins::BasicSafetyMessage* bsm) override;
+
+private:
+    std::vector<std::unique_ptr<Interface>> stages_{};
+};
+} // namespace attack
+} // namespace vasp
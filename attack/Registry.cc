@@ -0,0 +1,276 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <vasp/attack/Registry.h>
+
+#include <vasp/attack/dimension/Type.h>
+#include <vasp/attack/heading/Type.h>
+// ghost vehicle based attacks
+#include <vasp/attack/mobility/CommRangeBraking.h>
+#include <vasp/attack/position/ghost_vehicle/SuddenAppearance.h>
+#include <vasp/attack/position/ghost_vehicle/TargetedConstantPosition.h>
+#include <vasp/attack/safetyapp/eebl/JustAttack.h>
+#include <vasp/attack/safetyapp/eebl/StopAfterAttack.h>
+// self telemetry based attacks
+#include <vasp/attack/acceleration/Constant.h>
+#include <vasp/attack/acceleration/ConstantOffset.h>
+#include <vasp/attack/acceleration/High.h>
+#include <vasp/attack/acceleration/Low.h>
+#include <vasp/attack/acceleration/Random.h>
+#include <vasp/attack/acceleration/RandomOffset.h>
+#include <vasp/attack/channel/DenialOfService.h>
+#include <vasp/attack/dimension/BadRatio.h>
+#include <vasp/attack/dimension/ConstantOffset.h>
+#include <vasp/attack/dimension/High.h>
+#include <vasp/attack/dimension/Low.h>
+#include <vasp/attack/dimension/Random.h>
+#include <vasp/attack/dimension/RandomOffset.h>
+#include <vasp/attack/heading/Constant.h>
+#include <vasp/attack/heading/ConstantOffset.h>
+#include <vasp/attack/heading/High.h>
+#include <vasp/attack/heading/Low.h>
+#include <vasp/attack/heading/Opposite.h>
+#include <vasp/attack/heading/Perpendicular.h>
+#include <vasp/attack/heading/Random.h>
+#include <vasp/attack/heading/RandomOffset.h>
+#include <vasp/attack/heading/Rotating.h>
+#include <vasp/attack/position/self_telemetry/ConstantOffset.h>
+#include <vasp/attack/position/self_telemetry/PlaygroundConstantPosition.h>
+#include <vasp/attack/position/self_telemetry/Random.h>
+#include <vasp/attack/position/self_telemetry/RandomOffset.h>
+#include <vasp/attack/position/self_telemetry/SuddenDisappearance.h>
+#include <vasp/attack/safetyapp/ima/HighAcceleration.h>
+#include <vasp/attack/safetyapp/ima/HighSpeed.h>
+#include <vasp/attack/safetyapp/ima/JunctionPosition.h>
+#include <vasp/attack/safetyapp/ima/LowAcceleration.h>
+#include <vasp/attack/safetyapp/ima/LowSpeed.h>
+#include <vasp/attack/safetyapp/ima/PositionOffset.h>
+#include <vasp/attack/speed/Constant.h>
+#include <vasp/attack/speed/ConstantOffset.h>
+#include <vasp/attack/speed/High.h>
+#include <vasp/attack/speed/Low.h>
+#include <vasp/attack/speed/Random.h>
+#include <vasp/attack/speed/RandomOffset.h>
+
+namespace vasp {
+namespace attack {
+namespace {
+
+// factories shared by the registrations below
+
+template <class T>
+std::unique_ptr<Interface> make(Parameters const& /* params */, int const /* subType */)
+{
+    return std::make_unique<T>();
+}
+
+template <class T, double Parameters::*Offset>
+std::unique_ptr<Interface> makeOffset(Parameters const& params, int const /* subType */)
+{
+    return std::make_unique<T>(params.*Offset);
+}
+
+template <class T, class SubType>
+std::unique_ptr<Interface> makeTyped(Parameters const& /* params */, int const subType)
+{
+    auto attack = std::make_unique<T>();
+    attack->setType(static_cast<SubType>(subType));
+    return attack;
+}
+
+template <class T, class SubType, double Parameters::*Offset>
+std::unique_ptr<Interface> makeTypedOffset(Parameters const& params, int const subType)
+{
+    auto attack = std::make_unique<T>(params.*Offset);
+    attack->setType(static_cast<SubType>(subType));
+    return attack;
+}
+
+template <class T>
+std::unique_ptr<Interface> makeInWorld(Parameters const& params, int const /* subType */)
+{
+    return std::make_unique<T>(params.world);
+}
+
+auto constexpr kNone = kCategoryNone;
+auto constexpr kSelf = kCategorySelfTelemetry;
+auto constexpr kGhost = kCategoryGhost;
+auto constexpr kChannel = kCategoryChannel;
+
+auto constexpr kLength = dimension::kDimensionAttackTypeLength;
+auto constexpr kWidth = dimension::kDimensionAttackTypeWidth;
+auto constexpr kDimension = dimension::kDimensionAttackTypeBoth;
+auto constexpr kHeading = heading::kHyraTypeHeading;
+auto constexpr kYawRate = heading::kHyraTypeYawRate;
+auto constexpr kHeadingYawRate = heading::kHyraTypeBoth;
+
+// one registration per attack::Type, in the order of the enum
+constexpr Registration kRegistry[] = {
+    {kAttackNo, kNone, kNoSubType, "Genuine", nullptr},
+
+    {kAttackRandomPosition, kSelf, kNoSubType, "RandomPosition", &makeInWorld<position::Random>},
+    {kAttackRandomPositionOffset, kSelf, kNoSubType, "RandomOffset", &makeOffset<position::RandomOffset, &Parameters::posOffset>},
+    {kAttackConstantPositionOffset, kSelf, kNoSubType, "ConstantOffset", &makeOffset<position::ConstantOffset, &Parameters::posOffset>},
+    {kAttackPlaygroundConstantPosition, kSelf, kNoSubType, "PlaygroundConstantPosition", &makeInWorld<position::PlaygroundConstantPosition>},
+    {kAttackSuddenDisappearance, kSelf, kNoSubType, "SuddenDisappearance", &make<position::SuddenDisappearance>},
+
+    {kAttackSuddenAppearance, kGhost, kNoSubType, "SuddenAppearance", &make<position::SuddenAppearance>},
+    {kAttackTargetedConstantPosition, kGhost, kNoSubType, "TargetedConstantPosition", &makeOffset<position::TargetedConstantPosition, &Parameters::posOffset>},
+
+    {kAttackCommRangeBraking, kGhost, kNoSubType, "CommRangeBraking", &makeOffset<mobility::CommRangeBraking, &Parameters::ghostDistance>},
+
+    {kAttackDenialOfService, kChannel, kNoSubType, "DenialOfService", &make<channel::DenialOfService>},
+
+    {kAttackFakeEEBLJustAttack, kGhost, kNoSubType, "FakeEEBLJustAttack", &make<safetyapp::eebl::JustAttack>},
+    {kAttackFakeEEBLStopPositionUpdateAfterAttack, kGhost, kNoSubType, "FakeEEBLStopPositionUpdateAfterAttack", &make<safetyapp::eebl::StopAfterAttack>},
+
+    {kAttackIMAPosOffset, kSelf, kNoSubType, "IMAPositionOffset", &make<safetyapp::ima::PositionOffset>},
+    {kAttackIMAJunctionPos, kSelf, kNoSubType, "JunctionPosition", &make<safetyapp::ima::JunctionPosition>},
+    {kAttackIMAHighSpeed, kSelf, kNoSubType, "IMAHighSpeed", &make<safetyapp::ima::HighSpeed>},
+    {kAttackIMALowSpeed, kSelf, kNoSubType, "IMALowSpeed", &make<safetyapp::ima::LowSpeed>},
+    {kAttackIMAHighAcceleration, kSelf, kNoSubType, "IMAHighAcceleration", &make<safetyapp::ima::HighAcceleration>},
+    {kAttackIMALowAcceleration, kSelf, kNoSubType, "IMALowAcceleration", &make<safetyapp::ima::LowAcceleration>},
+
+    {kAttackHighDimension, kSelf, kDimension, "HighDimension", &makeTyped<dimension::High, dimension::Type>},
+    {kAttackLowDimension, kSelf, kDimension, "LowDimension", &makeTyped<dimension::Low, dimension::Type>},
+    {kAttackRandomDimension, kSelf, kDimension, "RandomDimension", &makeTyped<dimension::Random, dimension::Type>},
+    {kAttackRandomDimensionOffset, kSelf, kDimension, "RandomOffsetDimension", &makeTypedOffset<dimension::RandomOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackConstantDimensionOffset, kSelf, kDimension, "ConstantOffsetDimension", &makeTypedOffset<dimension::ConstantOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackBadRatioDimension, kSelf, kDimension, "BadRatioDimension", &makeTyped<dimension::BadRatio, dimension::Type>},
+
+    {kAttackHighLength, kSelf, kLength, "HighLength", &makeTyped<dimension::High, dimension::Type>},
+    {kAttackLowLength, kSelf, kLength, "LowLength", &makeTyped<dimension::Low, dimension::Type>},
+    {kAttackRandomLength, kSelf, kLength, "RandomLength", &makeTyped<dimension::Random, dimension::Type>},
+    {kAttackRandomLengthOffset, kSelf, kLength, "RandomOffsetLength", &makeTypedOffset<dimension::RandomOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackConstantLengthOffset, kSelf, kLength, "ConstantOffsetLength", &makeTypedOffset<dimension::ConstantOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackBadRatioLength, kSelf, kLength, "BadRatioLength", &makeTyped<dimension::BadRatio, dimension::Type>},
+
+    {kAttackHighWidth, kSelf, kWidth, "HighWidth", &makeTyped<dimension::High, dimension::Type>},
+    {kAttackLowWidth, kSelf, kWidth, "LowWidth", &makeTyped<dimension::Low, dimension::Type>},
+    {kAttackRandomWidth, kSelf, kWidth, "RandomWidth", &makeTyped<dimension::Random, dimension::Type>},
+    {kAttackRandomWidthOffset, kSelf, kWidth, "RandomOffsetWidth", &makeTypedOffset<dimension::RandomOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackConstantWidthOffset, kSelf, kWidth, "ConstantOffsetWidth", &makeTypedOffset<dimension::ConstantOffset, dimension::Type, &Parameters::dimensionOffset>},
+    {kAttackBadRatioWidth, kSelf, kWidth, "BadRatioWidth", &makeTyped<dimension::BadRatio, dimension::Type>},
+
+    {kAttackOppositeHeading, kSelf, kNoSubType, "OppositeHeading", &make<heading::Opposite>},
+    {kAttackPerpendicularHeading, kSelf, kNoSubType, "PerpendicularHeading", &make<heading::Perpendicular>},
+    {kAttackRotatingHeading, kSelf, kNoSubType, "RotatingHeading", &make<heading::Rotating>},
+    {kAttackConstantHeading, kSelf, kHeading, "ConstantHeading", &makeTyped<heading::Constant, heading::Type>},
+    {kAttackRandomHeading, kSelf, kHeading, "RandomHeading", &makeTyped<heading::Random, heading::Type>},
+    {kAttackRandomHeadingOffset, kSelf, kHeading, "RandomHeadingOffset", &makeTypedOffset<heading::RandomOffset, heading::Type, &Parameters::yawRateOffset>},
+    {kAttackConstantHeadingOffset, kSelf, kHeading, "ConstantHeadingOffset", &makeTypedOffset<heading::ConstantOffset, heading::Type, &Parameters::yawRateOffset>},
+
+    {kAttackHighYawRate, kSelf, kYawRate, "HighYawRate", &makeTyped<heading::High, heading::Type>},
+    {kAttackLowYawRate, kSelf, kYawRate, "LowYawRate", &makeTyped<heading::Low, heading::Type>},
+    {kAttackConstantYawRate, kSelf, kYawRate, "ConstantYawRate", &makeTyped<heading::Constant, heading::Type>},
+    {kAttackRandomYawRate, kSelf, kYawRate, "RandomYawRate", &makeTyped<heading::Random, heading::Type>},
+    {kAttackRandomYawRateOffset, kSelf, kYawRate, "RandomYawRateOffset", &makeTypedOffset<heading::RandomOffset, heading::Type, &Parameters::yawRateOffset>},
+    {kAttackConstantYawRateOffset, kSelf, kYawRate, "ConstantYawRateOffset", &makeTypedOffset<heading::ConstantOffset, heading::Type, &Parameters::yawRateOffset>},
+
+    {kAttackHighHeadingYawRate, kSelf, kHeadingYawRate, "HighHeadingYawRate", &makeTyped<heading::High, heading::Type>},
+    {kAttackLowHeadingYawRate, kSelf, kHeadingYawRate, "LowHeadingYawRate", &makeTyped<heading::Low, heading::Type>},
+    {kAttackConstantHeadingYawRate, kSelf, kHeadingYawRate, "ConstantHeadingYawRate", &makeTyped<heading::Constant, heading::Type>},
+    {kAttackRandomHeadingYawRate, kSelf, kHeadingYawRate, "RandomHeadingYawRate", &makeTyped<heading::Random, heading::Type>},
+    {kAttackRandomHeadingYawRateOffset, kSelf, kHeadingYawRate, "RandomHeadingYawRateOffset", &makeTypedOffset<heading::RandomOffset, heading::Type, &Parameters::yawRateOffset>},
+    {kAttackConstantHeadingYawRateOffset, kSelf, kHeadingYawRate, "ConstantHeadingYawRateOffset", &makeTypedOffset<heading::ConstantOffset, heading::Type, &Parameters::yawRateOffset>},
+
+    {kAttackHighAcceleration, kSelf, kNoSubType, "HighAcceleration", &make<acceleration::High>},
+    {kAttackLowAcceleration, kSelf, kNoSubType, "LowAcceleration", &make<acceleration::Low>},
+    {kAttackConstantAcceleration, kSelf, kNoSubType, "ConstantAcceleration", &make<acceleration::Constant>},
+    {kAttackRandomAcceleration, kSelf, kNoSubType, "RandomAcceleration", &make<acceleration::Random>},
+    {kAttackRandomAccelerationOffset, kSelf, kNoSubType, "RandomAccelerationOffset", &makeOffset<acceleration::RandomOffset, &Parameters::accelerationOffset>},
+    {kAttackConstantAccelerationOffset, kSelf, kNoSubType, "ConstantAccelerationOffset", &makeOffset<acceleration::ConstantOffset, &Parameters::accelerationOffset>},
+
+    {kAttackHighSpeed, kSelf, kNoSubType, "HighSpeed", &make<speed::High>},
+    {kAttackLowSpeed, kSelf, kNoSubType, "LowSpeed", &make<speed::Low>},
+    {kAttackConstantSpeed, kSelf, kNoSubType, "ConstantSpeed", &make<speed::Constant>},
+    {kAttackRandomSpeed, kSelf, kNoSubType, "RandomSpeed", &make<speed::Random>},
+    {kAttackRandomSpeedOffset, kSelf, kNoSubType, "RandomSpeedOffset", &makeOffset<speed::RandomOffset, &Parameters::speedOffset>},
+    {kAttackConstantSpeedOffset, kSelf, kNoSubType, "ConstantSpeedOffset", &makeOffset<speed::ConstantOffset, &Parameters::speedOffset>},
+
+    {kAttackRandomlySelectedAttack, kNone, kNoSubType, "RandomlySelectedAttack", nullptr},
+    {kAttackAlwaysRandomAttack, kNone, kNoSubType, "AlwaysRandomAttack", nullptr},
+
+    // assembled from the attackPipeline option by the CarApp
+    {kAttackPipeline, kNone, kNoSubType, "Pipeline", nullptr},
+};
+
+int constexpr kRegistrySize = sizeof(kRegistry) / sizeof(kRegistry[0]);
+
+constexpr bool isIndexedByType()
+{
+    for (int i = 0; i < kRegistrySize; ++i) {
+        if (kRegistry[i].type != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(kRegistrySize == _kAttackMaxValue, "every attack::Type needs a registration");
+static_assert(isIndexedByType(), "registrations must follow the order of attack::Type");
+
+constexpr Registration kUnregistered{_kAttackMaxValue, kNone, kNoSubType, "Unknown", nullptr};
+
+} // namespace
+
+Registration const& getRegistration(int const type)
+{
+    if (type < 0 or type >= kRegistrySize) {
+        return kUnregistered;
+    }
+    return kRegistry[type];
+}
+
+std::vector<Type> const& getSelectableTypes()
+{
+    static std::vector<Type> const types = [] {
+        std::vector<Type> selectable{};
+        for (auto const& registration : kRegistry) {
+            if (registration.factory != nullptr) {
+                selectable.push_back(registration.type);
+            }
+        }
+        return selectable;
+    }();
+    return types;
+}
+
+std::unique_ptr<Interface> create(int const type, Parameters const& params)
+{
+    auto const& registration = getRegistration(type);
+    if (registration.factory == nullptr) {
+        return nullptr;
+    }
+    auto attack = registration.factory(params, registration.subType);
+    attack->setAttackType(registration.type);
+    return attack;
+}
+
+} // namespace attack
+} // namespace vasp
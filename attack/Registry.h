@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <vasp/attack/Interface.h>
+#include <vasp/attack/Type.h>
+
+// forward declarations
+namespace veins {
+class BaseWorldUtility;
+} // namespace veins
+
+namespace vasp {
+namespace attack {
+
+enum Category {
+    kCategoryNone, // no attack, or a type that selects other attacks
+    kCategorySelfTelemetry, // modifies the attacker's own BSMs
+    kCategoryGhost, // sends BSMs on behalf of a ghost vehicle
+    kCategoryChannel // labels extra BSMs the attacker floods the channel with
+};
+
+// attacker settings the attacks are constructed from
+struct Parameters {
+    veins::BaseWorldUtility* world{nullptr};
+    double posOffset{};
+    double dimensionOffset{};
+    double yawRateOffset{};
+    double accelerationOffset{};
+    double speedOffset{};
+    double ghostDistance{};
+};
+
+using Factory = std::unique_ptr<Interface> (*)(Parameters const& params, int const subType);
+
+int constexpr kNoSubType{-1};
+
+struct Registration {
+    Type type;
+    Category category;
+    int subType; // dimension::Type or heading::Type handed to the factory
+    char const* label; // attack type written to the trace for BSMs labelled with this type
+    Factory factory; // nullptr for kCategoryNone
+};
+
+// registration of an attack type; types without one map to a kCategoryNone entry
+Registration const& getRegistration(int const type);
+
+// attack types random attack selection draws from: every type with a factory
+std::vector<Type> const& getSelectableTypes();
+
+// new instance of the given attack type, nullptr if the type has no factory
+std::unique_ptr<Interface> create(int const type, Parameters const& params);
+
+} // namespace attack
+} // namespace vasp
@@ -133,6 +133,9 @@ enum Type {
     kAttackRandomlySelectedAttack,
     kAttackAlwaysRandomAttack,
 
+    // Ordered combination of self telemetry attacks, see the attackPipeline option
+    kAttackPipeline,
+
     _kAttackMaxValue
 };
 } // namespace attack
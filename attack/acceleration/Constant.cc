@@ -34,7 +34,7 @@ namespace attack {
 namespace acceleration {
 void Constant::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("ConstantAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
     bsm->setAcceleration(5);
 }
 } // namespace acceleration
@@ -39,7 +39,7 @@ ConstantOffset::ConstantOffset(double const offset)
 
 void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("ConstantAccelerationOffset");
+    markAttacked(bsm, kFieldAcceleration);
     bsm->setAcceleration(bsm->getAcceleration() + offset_);
 }
 } // namespace acceleration
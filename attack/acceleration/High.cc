@@ -34,7 +34,7 @@ namespace attack {
 namespace acceleration {
 void High::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("HighAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
 
     // maximal acceleration as defined in ETSI TS 102 894-2: 16m/s^2
     bsm->setAcceleration(16.5);
@@ -34,7 +34,7 @@ namespace attack {
 namespace acceleration {
 void Low::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("LowAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
 
     // minimal acceleration as defined in ETSI TS 102 894-2: -16m/s^2
     bsm->setAcceleration(-16.5);
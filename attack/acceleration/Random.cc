@@ -36,7 +36,7 @@ namespace attack {
 namespace acceleration {
 void Random::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RandomAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
 
     auto rng = getEnvir()->getRNG(0);
     bsm->setAcceleration(uniform(rng, -INFINITY, INFINITY));
@@ -41,7 +41,7 @@ RandomOffset::RandomOffset(double const offset)
 
 void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RandomAccelerationOffset");
+    markAttacked(bsm, kFieldAcceleration);
 
     auto rng = getEnvir()->getRNG(0);
     bsm->setAcceleration(bsm->getAcceleration() + uniform(rng, -offset_, offset_));
@@ -28,19 +28,15 @@
 
 #pragma once
 
-#include <omnetpp/simtime_t.h>
 #include <vasp/attack/Interface.h>
 
 namespace vasp {
 namespace attack {
 namespace channel {
+// Labels the flood BSMs sent by the attacker's DoS scheduler, see CarApp.
 class DenialOfService final : public Interface {
 public:
-    DenialOfService(omnetpp::simtime_t& beaconInterval, int const nDosMessages);
     void attack(veins::BasicSafetyMessage* bsm) override;
-
-private:
-    static bool updateBeaconInterval_;
 };
 } // namespace channel
 } // namespace attack
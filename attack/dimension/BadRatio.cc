@@ -44,7 +44,7 @@ void BadRatio::attack(veins::BasicSafetyMessage* bsm)
     double const kLength{bsm->getWidth() + uniform(rng, -(bsm->getWidth() - EPSILON), -EPSILON)};
     double const kWidth{bsm->getLength() + uniform(rng, EPSILON, (kMaxLength + EPSILON) - bsm->getLength())};
 
-    setParams(bsm, "BadRatio", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
@@ -32,9 +32,9 @@
 namespace vasp {
 namespace attack {
 namespace dimension {
-void ConstantOffset::update(double const offset)
+ConstantOffset::ConstantOffset(double const offset)
+    : offset_(offset)
 {
-    offset_ = offset;
 }
 
 void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
@@ -44,7 +44,7 @@ void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
     double const kLength{bsm->getLength() + offset_};
     double const kWidth{bsm->getWidth() + offset_};
 
-    setParams(bsm, "ConstantOffset", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
@@ -35,11 +35,11 @@ namespace attack {
 namespace dimension {
 class ConstantOffset final : public Interface {
 public:
-    void update(double const offset);
+    ConstantOffset(double const offset);
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
-    double offset_;
+    double offset_{};
 };
 } // namespace dimension
 } // namespace attack
@@ -39,7 +39,7 @@ void High::attack(veins::BasicSafetyMessage* bsm)
     double constexpr kLength{102.3};
     double constexpr kWidth{6.2};
 
-    setParams(bsm, "High", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
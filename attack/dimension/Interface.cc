@@ -32,21 +32,21 @@
 namespace vasp {
 namespace attack {
 namespace dimension {
-void Interface::setParams(veins::BasicSafetyMessage* bsm, std::string const& str, double const length, double const width)
+void Interface::setParams(veins::BasicSafetyMessage* bsm, double const length, double const width)
 {
     switch (type_) {
     case kDimensionAttackTypeLength: {
-        bsm->setAttackType((str + "Length").c_str());
+        markAttacked(bsm, kFieldLength);
         bsm->setLength(length);
         break;
     }
     case kDimensionAttackTypeWidth: {
-        bsm->setAttackType((str + "Width").c_str());
+        markAttacked(bsm, kFieldWidth);
         bsm->setWidth(width);
         break;
     }
     case kDimensionAttackTypeBoth: {
-        bsm->setAttackType((str + "Dimension").c_str());
+        markAttacked(bsm, kFieldLength | kFieldWidth);
         bsm->setLength(length);
         bsm->setWidth(width);
         break;
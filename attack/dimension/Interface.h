@@ -30,7 +30,6 @@
 
 #include <vasp/attack/Interface.h>
 #include <vasp/attack/dimension/Type.h>
-#include <string>
 
 namespace vasp {
 namespace attack {
@@ -44,7 +43,7 @@ public:
     virtual void attack(veins::BasicSafetyMessage* bsm) = 0;
 
 protected:
-    void setParams(veins::BasicSafetyMessage* bsm, std::string const& str, double const length, double const width);
+    void setParams(veins::BasicSafetyMessage* bsm, double const length, double const width);
 
 private:
     Type type_;
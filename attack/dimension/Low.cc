@@ -39,7 +39,7 @@ void Low::attack(veins::BasicSafetyMessage* bsm)
     double constexpr kLength{0.09};
     double constexpr kWidth{0.09};
 
-    setParams(bsm, "Low", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
@@ -43,7 +43,7 @@ void Random::attack(veins::BasicSafetyMessage* bsm)
     double const kLength{uniform(rng, -INFINITY, INFINITY)};
     double const kWidth{uniform(rng, -INFINITY, INFINITY)};
 
-    setParams(bsm, "Random", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
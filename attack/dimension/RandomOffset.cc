@@ -34,9 +34,9 @@
 namespace vasp {
 namespace attack {
 namespace dimension {
-void RandomOffset::update(double const offset)
+RandomOffset::RandomOffset(double const offset)
+    : offset_(offset)
 {
-    offset_ = offset;
 }
 
 void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
@@ -49,7 +49,7 @@ void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
     double const kLength{bsm->getLength() + uniform(rng, -offset_, offset_)};
     double const kWidth{bsm->getWidth() + uniform(rng, -offset_, offset_)};
 
-    setParams(bsm, "RandomOffset", kLength, kWidth);
+    setParams(bsm, kLength, kWidth);
 }
 } // namespace dimension
 } // namespace attack
@@ -33,26 +33,20 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void Constant::update(veins::Heading const& prevHeading, simtime_t_cref prevBeaconTime)
-{
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
-}
-
 void Constant::attack(veins::BasicSafetyMessage* bsm)
 {
     switch (type_) {
     case kHyraTypeHeading:
-        bsm->setAttackType("ConstantHeading");
+        markAttacked(bsm, kFieldHeading);
         bsm->setHeading(veins::Heading(M_PI_2));
         break;
     case kHyraTypeYawRate: {
-        bsm->setAttackType("ConstantYawRate");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(M_PI_2);
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("ConstantHeadingYawRate");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         double constexpr kYawRate{0};
         bsm->setYawRate(kYawRate);
 
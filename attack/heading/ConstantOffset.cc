@@ -33,11 +33,9 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void ConstantOffset::update(double const offset, veins::Heading const& prevHeading, simtime_t_cref prevBeaconTime)
+ConstantOffset::ConstantOffset(double const offset)
+    : offset_(offset)
 {
-    offset_ = offset;
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
 }
 
 void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
@@ -48,17 +46,17 @@ void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
 
     switch (type_) {
     case kHyraTypeHeading: {
-        bsm->setAttackType("ConstantHeadingOffset");
+        markAttacked(bsm, kFieldHeading);
         bsm->setHeading(veins::Heading(bsm->getHeading().getRad() + offset_));
         break;
     }
     case kHyraTypeYawRate: {
-        bsm->setAttackType("ConstantYawRateOffset");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(fmod(bsm->getYawRate() + offset_, 2 * M_PI));
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("ConstantHeadingYawRateOffset");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         auto const kYawRate{bsm->getYawRate() + offset_};
         bsm->setYawRate(kYawRate);
 
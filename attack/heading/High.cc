@@ -33,12 +33,6 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void High::update(veins::Heading const& prevHeading, omnetpp::simtime_t_cref prevBeaconTime)
-{
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
-}
-
 void High::attack(veins::BasicSafetyMessage* bsm)
 {
     // maximal yaw-rate (as defined in ETSI 102 894-2) = 327.66 degrees/second i.e. 5.7187458271 rads/second
@@ -48,12 +42,12 @@ void High::attack(veins::BasicSafetyMessage* bsm)
     case kHyraTypeHeading:
         break;
     case kHyraTypeYawRate: {
-        bsm->setAttackType("HighYawRate");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(kYawRate);
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("HighHeadingYawRate");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         bsm->setYawRate(kYawRate);
 
         // add the delta change in heading to previous heading to get new heading value
@@ -33,6 +33,12 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
+void Interface::update(BeaconContext const& context)
+{
+    prevHeading_ = context.prevHeading;
+    prevBeaconTime_ = context.prevBeaconTime;
+}
+
 veins::Heading const Interface::getNewHeading(veins::Heading const& prevHeading, double const yawRate, simtime_t_cref prevBeaconTime) const
 {
     auto tmpHeading{prevHeading.getRad() + yawRate * (simTime() - prevBeaconTime).dbl()};
@@ -31,10 +31,7 @@
 #include <omnetpp/simtime_t.h>
 #include <vasp/attack/Interface.h>
 #include <vasp/attack/heading/Type.h>
-
-namespace veins {
-class Heading;
-} // namespace veins
+#include <veins/base/utils/Heading.h>
 
 namespace vasp {
 namespace attack {
@@ -42,6 +39,7 @@ namespace heading {
 class Interface : public attack::Interface {
 public:
     virtual void attack(veins::BasicSafetyMessage* bsm) = 0;
+    void update(BeaconContext const& context) override;
     void setType(Type const type)
     {
         type_ = type;
@@ -52,6 +50,8 @@ protected:
 
 protected:
     Type type_;
+    veins::Heading prevHeading_{0.0};
+    omnetpp::simtime_t prevBeaconTime_{};
 };
 } // namespace heading
 } // namespace attack
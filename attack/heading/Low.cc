@@ -33,12 +33,6 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void Low::update(veins::Heading const& prevHeading, omnetpp::simtime_t_cref prevBeaconTime)
-{
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
-}
-
 void Low::attack(veins::BasicSafetyMessage* bsm)
 {
     // minimal yaw-rate (as defined in ETSI 102 894-2) = -327.66 degrees/second i.e. -5.7187458271 rads/second
@@ -48,12 +42,12 @@ void Low::attack(veins::BasicSafetyMessage* bsm)
     case kHyraTypeHeading:
         break;
     case kHyraTypeYawRate: {
-        bsm->setAttackType("LowYawRate");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(kYawRate);
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("LowHeadingYawRate");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         bsm->setYawRate(kYawRate);
 
         // add the delta change in heading to previous heading to get new heading value
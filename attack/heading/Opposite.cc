@@ -36,7 +36,7 @@ namespace heading {
 
 void Opposite::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("OppositeHeading");
+    markAttacked(bsm, kFieldHeading);
     bsm->setHeading(veins::Heading(bsm->getHeading().getRad() + M_PI));
 }
 
@@ -36,7 +36,7 @@ namespace heading {
 
 void Perpendicular::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("PerpendicularHeading");
+    markAttacked(bsm, kFieldHeading);
     bsm->setHeading(veins::Heading(bsm->getHeading().getRad() + M_PI_2));
 }
 
@@ -35,29 +35,23 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void Random::update(veins::Heading const& prevHeading, simtime_t_cref prevBeaconTime)
-{
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
-}
-
 void Random::attack(veins::BasicSafetyMessage* bsm)
 {
     auto rng = getEnvir()->getRNG(0);
 
     switch (type_) {
     case kHyraTypeHeading: {
-        bsm->setAttackType("RandomHeading");
+        markAttacked(bsm, kFieldHeading);
         bsm->setHeading(veins::Heading(uniform(rng, -2 * M_PI, 2 * M_PI)));
         break;
     }
     case kHyraTypeYawRate: {
-        bsm->setAttackType("RandomYawRate");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(uniform(rng, -2 * M_PI, 2 * M_PI));
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("RandomHeadingYawRate");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         auto constexpr kExtremeYawRate{-5.71892036};
         auto const kYawRate{uniform(rng, -kExtremeYawRate, kExtremeYawRate)};
         bsm->setYawRate(kYawRate);
@@ -35,11 +35,9 @@ namespace vasp {
 namespace attack {
 namespace heading {
 
-void RandomOffset::update(double const offset, veins::Heading const& prevHeading, simtime_t_cref prevBeaconTime)
+RandomOffset::RandomOffset(double const offset)
+    : offset_(offset)
 {
-    offset_ = offset;
-    prevHeading_ = prevHeading;
-    prevBeaconTime_ = prevBeaconTime;
 }
 
 void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
@@ -52,19 +50,19 @@ void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
 
     switch (type_) {
     case kHyraTypeHeading: {
-        bsm->setAttackType("RandomHeadingOffset");
+        markAttacked(bsm, kFieldHeading);
         // get new randomly offset heading
         bsm->setHeading(
             veins::Heading(fmod(bsm->getHeading().getRad() + uniform(rng, -offset_, offset_), 2 * M_PI)));
         break;
     }
     case kHyraTypeYawRate: {
-        bsm->setAttackType("RandomYawRateOffset");
+        markAttacked(bsm, kFieldYawRate);
         bsm->setYawRate(fmod(bsm->getYawRate() + uniform(rng, -offset_, offset_), 2 * M_PI));
         break;
     }
     case kHyraTypeBoth: {
-        bsm->setAttackType("RandomHeadingYawRateOffset");
+        markAttacked(bsm, kFieldHeading | kFieldYawRate);
         auto const kYawRate{bsm->getYawRate() + uniform(rng, -offset_, offset_)};
         bsm->setYawRate(kYawRate);
 
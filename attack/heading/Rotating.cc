@@ -36,7 +36,7 @@ namespace heading {
 
 void Rotating::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RotatingHeading");
+    markAttacked(bsm, kFieldHeading);
     bsm->setHeading(veins::Heading(bsm->getHeading().getRad() + 0.1 * M_PI));
 }
 
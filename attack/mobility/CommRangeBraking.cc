@@ -34,23 +34,26 @@ namespace vasp {
 namespace attack {
 namespace mobility {
 
-CommRangeBraking::CommRangeBraking(
-    veins::BasicSafetyMessage const* rvBsm,
-    double& distance,
-    veins::Coord const& senderSpeed)
-    : ghostVehiclePos_{utils::getPosOffset(rvBsm, distance)}
-    , senderSpeed_(senderSpeed)
+CommRangeBraking::CommRangeBraking(double const distance)
+    : distance_(distance)
 {
+}
+
+void CommRangeBraking::update(BeaconContext const& context)
+{
+    ghostVehiclePos_ = utils::getPosOffset(context.target->position, context.target->heading, distance_);
+    senderSpeed_ = context.hostSpeed;
+
     // keep ghost vehicle from going behind target vehicle
-    if (distance > 5) {
-        distance -= 5;
+    if (distance_ > 5) {
+        distance_ -= 5;
     }
 }
 
 void CommRangeBraking::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setData("ghost");
-    bsm->setAttackType("CommRangeBraking");
+    bsm->setGhost(true);
+    markAttacked(bsm, kFieldPosition | kFieldSpeed);
     bsm->setSenderPos(ghostVehiclePos_);
     bsm->setSenderSpeed(senderSpeed_);
 }
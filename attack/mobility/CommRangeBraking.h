@@ -36,10 +36,12 @@ namespace attack {
 namespace mobility {
 class CommRangeBraking final : public Interface {
 public:
-    CommRangeBraking(veins::BasicSafetyMessage const* rvBsm, double& distance, veins::Coord const& senderSpeed);
+    CommRangeBraking(double const distance);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
+    double distance_{};
     veins::Coord ghostVehiclePos_{};
     veins::Coord senderSpeed_{};
 };
@@ -34,20 +34,20 @@ namespace vasp {
 namespace attack {
 namespace position {
 
-SuddenAppearance::SuddenAppearance(veins::BasicSafetyMessage const* rvBsm)
+void SuddenAppearance::update(BeaconContext const& context)
 {
     // get target's safety distance
-    auto const targetSafetyDistance = utils::getSafetyDistance(rvBsm->getSenderSpeed());
+    auto const targetSafetyDistance = utils::getSafetyDistance(context.target->speed);
     // put ghost within target's safety distance
     auto const ghostVehicleOffset = targetSafetyDistance - 0.1;
     // calculate attacker's position w.r.t. target's safety distance
-    posOffset_ = utils::getPosOffset(rvBsm, ghostVehicleOffset);
+    posOffset_ = utils::getPosOffset(context.target->position, context.target->heading, ghostVehicleOffset);
 }
 
 void SuddenAppearance::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("SuddenAppearance");
-    bsm->setData("ghost");
+    markAttacked(bsm, kFieldPosition | kFieldSpeed);
+    bsm->setGhost(true);
     bsm->setSenderPos(posOffset_);
     bsm->setSenderSpeed(veins::Coord::ZERO);
 }
@@ -36,7 +36,7 @@ namespace attack {
 namespace position {
 class SuddenAppearance final : public Interface {
 public:
-    SuddenAppearance(veins::BasicSafetyMessage const* rvBsm);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
@@ -34,19 +34,23 @@ namespace vasp {
 namespace attack {
 namespace position {
 
-TargetedConstantPosition::TargetedConstantPosition(veins::BasicSafetyMessage const* rvBsm, double const offset, veins::Coord& ghostPos, bool& attackFlag)
+TargetedConstantPosition::TargetedConstantPosition(double const posOffset)
+    : posOffset_(posOffset)
 {
-    if (attackFlag) {
-        ghostPos = utils::getPosOffset(rvBsm, offset);
-        attackFlag = false;
+}
+
+void TargetedConstantPosition::update(BeaconContext const& context)
+{
+    if (attackFlag_) {
+        ghostPos_ = utils::getPosOffset(context.target->position, context.target->heading, posOffset_);
+        attackFlag_ = false;
     }
-    ghostPos_ = ghostPos;
 }
 
 void TargetedConstantPosition::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("TargetedConstantPosition");
-    bsm->setData("ghost");
+    markAttacked(bsm, kFieldPosition | kFieldSpeed);
+    bsm->setGhost(true);
     bsm->setSenderSpeed(veins::Coord::ZERO);
     bsm->setSenderPos(ghostPos_);
 }
@@ -36,10 +36,13 @@ namespace attack {
 namespace position {
 class TargetedConstantPosition final : public Interface {
 public:
-    TargetedConstantPosition(veins::BasicSafetyMessage const* rvBsm, double const posOffset, veins::Coord& ghostPos, bool& attackFlag);
+    TargetedConstantPosition(double const posOffset);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
+    double posOffset_{};
+    bool attackFlag_{true}; // the ghost is placed next to the first target only
     veins::Coord ghostPos_{};
 };
 } // namespace position
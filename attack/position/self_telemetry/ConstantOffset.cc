@@ -40,7 +40,7 @@ ConstantOffset::ConstantOffset(double const offset)
 
 void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("ConstantOffset");
+    markAttacked(bsm, kFieldPosition);
     bsm->setSenderPos(bsm->getSenderPos() + veins::Coord(offset_, offset_));
 }
 
@@ -41,7 +41,7 @@ PlaygroundConstantPosition::PlaygroundConstantPosition(veins::BaseWorldUtility*
 
 void PlaygroundConstantPosition::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("PlaygroundConstantPosition");
+    markAttacked(bsm, kFieldPosition);
     bsm->setSenderPos(playgroundSize_ / 2);
 }
 
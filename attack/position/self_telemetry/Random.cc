@@ -35,13 +35,19 @@ namespace attack {
 namespace position {
 
 Random::Random(veins::BaseWorldUtility* world)
-    : randomPosition_(world->getRandomPosition())
+    : world_(world)
 {
 }
 
+void Random::update(BeaconContext const& /* context */)
+{
+    // a new random position for every beacon
+    randomPosition_ = world_->getRandomPosition();
+}
+
 void Random::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RandomPosition");
+    markAttacked(bsm, kFieldPosition);
     bsm->setSenderPos(randomPosition_);
 }
 
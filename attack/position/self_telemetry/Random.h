@@ -41,9 +41,11 @@ namespace position {
 class Random final : public Interface {
 public:
     Random(veins::BaseWorldUtility* world);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
+    veins::BaseWorldUtility* world_;
     veins::Coord randomPosition_{};
 };
 } // namespace position
@@ -45,7 +45,7 @@ void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
 {
     auto rng = getEnvir()->getRNG(0);
 
-    bsm->setAttackType("RandomOffset");
+    markAttacked(bsm, kFieldPosition);
     bsm->setSenderPos(bsm->getSenderPos() + veins::Coord(uniform(rng, -offset_, offset_), uniform(rng, -offset_, offset_)));
 }
 
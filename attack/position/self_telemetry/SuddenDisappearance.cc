@@ -35,7 +35,7 @@ namespace position {
 
 void SuddenDisappearance::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("SuddenDisappearance");
+    markAttacked(bsm, kFieldNone);
     delete bsm;
     bsm = nullptr;
 }
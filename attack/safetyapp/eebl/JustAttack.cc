@@ -35,15 +35,15 @@ namespace attack {
 namespace safetyapp {
 namespace eebl {
 
-JustAttack::JustAttack(veins::BasicSafetyMessage const* rvBsm)
-    : ghostPos_(utils::getPosOffset(rvBsm, kGhostVehicleOffset_))
+void JustAttack::update(BeaconContext const& context)
 {
+    ghostPos_ = utils::getPosOffset(context.target->position, context.target->heading, kGhostVehicleOffset_);
 }
 
 void JustAttack::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("FakeEEBLJustAttack");
-    bsm->setData("ghost");
+    markAttacked(bsm, kFieldPosition | kFieldSpeed | kFieldAcceleration | kFieldHardBraking);
+    bsm->setGhost(true);
     bsm->setSenderPos(ghostPos_);
     bsm->setSenderSpeed(veins::Coord::ZERO); // creates a speed object with speed = 0
     bsm->setEventHardBraking(true);
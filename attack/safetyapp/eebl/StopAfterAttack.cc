@@ -38,7 +38,7 @@ namespace eebl {
 
 bool StopAfterAttack::attackFlag_ = false;
 
-StopAfterAttack::StopAfterAttack(veins::BasicSafetyMessage const* rvBsm)
+void StopAfterAttack::update(BeaconContext const& context)
 {
     if (!attackFlag_) {
         return;
@@ -46,13 +46,13 @@ StopAfterAttack::StopAfterAttack(veins::BasicSafetyMessage const* rvBsm)
 
     auto constexpr ghostVehicleOffset = 0.2; // put ghost just within target's safety distance
     // calculate ghost vehicle's position w.r.t. target's safety distance
-    ghostPos_ = utils::getPosOffset(rvBsm, ghostVehicleOffset);
+    ghostPos_ = utils::getPosOffset(context.target->position, context.target->heading, ghostVehicleOffset);
     attackFlag_ = false;
 }
 
 void StopAfterAttack::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("FakeEEBLStopPositionUpdateAfterAttack");
+    markAttacked(bsm, kFieldPosition | kFieldSpeed | kFieldAcceleration | kFieldHardBraking);
     bsm->setSenderSpeed(veins::Coord::ZERO); // creates a speed object with speed = 0
     bsm->setEventHardBraking(true);
     bsm->setSenderPos(ghostPos_);
@@ -37,7 +37,7 @@ namespace safetyapp {
 namespace eebl {
 class StopAfterAttack final : public Interface {
 public:
-    StopAfterAttack(veins::BasicSafetyMessage const* rvBsm);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
@@ -34,14 +34,9 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-HighAcceleration::HighAcceleration(bool const approachingIntersection)
-{
-    approachingIntersection_ = approachingIntersection;
-}
-
 void HighAcceleration::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("IMAHighAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
     bsm->setAcceleration(bsm->getAcceleration() + 100);
 }
 
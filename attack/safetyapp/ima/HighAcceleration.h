@@ -36,7 +36,6 @@ namespace safetyapp {
 namespace ima {
 class HighAcceleration final : public Interface {
 public:
-    HighAcceleration(bool const approachingIntersection);
     void attack(veins::BasicSafetyMessage* bsm) override;
 };
 } // namespace ima
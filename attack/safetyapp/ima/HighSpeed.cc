@@ -34,14 +34,9 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-HighSpeed::HighSpeed(bool const approachingIntersection)
-{
-    approachingIntersection_ = approachingIntersection;
-}
-
 void HighSpeed::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("IMAHighSpeed");
+    markAttacked(bsm, kFieldSpeed);
     bsm->setSenderSpeed(bsm->getSenderSpeed() + bsm->getHeading().toCoord() * 100);
 }
 
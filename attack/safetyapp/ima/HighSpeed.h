@@ -36,7 +36,6 @@ namespace safetyapp {
 namespace ima {
 class HighSpeed final : public Interface {
 public:
-    HighSpeed(bool const approachingIntersection);
     void attack(veins::BasicSafetyMessage* bsm) override;
 };
 } // namespace ima
@@ -37,6 +37,10 @@ namespace ima {
 class Interface : public attack::Interface {
 public:
     virtual void attack(veins::BasicSafetyMessage* bsm) override = 0;
+    void update(BeaconContext const& context) override
+    {
+        approachingIntersection_ = context.approachingIntersection;
+    }
 
 protected:
     bool approachingIntersection_{false};
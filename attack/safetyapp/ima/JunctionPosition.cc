@@ -34,16 +34,16 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-JunctionPosition::JunctionPosition(bool const approachingIntersection, veins::Coord const& junctionPos)
-    : junctionPos_(junctionPos)
+void JunctionPosition::update(BeaconContext const& context)
 {
-    approachingIntersection_ = approachingIntersection;
+    Interface::update(context);
+    junctionPos_ = context.junctionPos;
 }
 
 void JunctionPosition::attack(veins::BasicSafetyMessage* bsm)
 {
     if (approachingIntersection_) {
-        bsm->setAttackType("JunctionPosition");
+        markAttacked(bsm, kFieldPosition);
         bsm->setSenderPos(junctionPos_);
     }
 }
@@ -37,7 +37,7 @@ namespace safetyapp {
 namespace ima {
 class JunctionPosition final : public Interface {
 public:
-    JunctionPosition(bool const approachingIntersection, veins::Coord const& junctionPos);
+    void update(BeaconContext const& context) override;
     void attack(veins::BasicSafetyMessage* bsm) override;
 
 private:
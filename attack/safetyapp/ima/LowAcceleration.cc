@@ -34,14 +34,9 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-LowAcceleration::LowAcceleration(bool const approachingIntersection)
-{
-    approachingIntersection_ = approachingIntersection;
-}
-
 void LowAcceleration::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("IMALowAcceleration");
+    markAttacked(bsm, kFieldAcceleration);
     bsm->setAcceleration(bsm->getAcceleration() - 100);
 }
 
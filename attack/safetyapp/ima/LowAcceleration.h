@@ -36,7 +36,6 @@ namespace safetyapp {
 namespace ima {
 class LowAcceleration final : public Interface {
 public:
-    LowAcceleration(bool const approachingIntersection);
     void attack(veins::BasicSafetyMessage* bsm) override;
 };
 } // namespace ima
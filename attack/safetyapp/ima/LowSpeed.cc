@@ -34,14 +34,9 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-LowSpeed::LowSpeed(bool const approachingIntersection)
-{
-    approachingIntersection_ = approachingIntersection;
-}
-
 void LowSpeed::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("IMALowSpeed");
+    markAttacked(bsm, kFieldSpeed);
     bsm->setSenderSpeed(bsm->getSenderSpeed() - bsm->getHeading().toCoord() * 100);
 }
 
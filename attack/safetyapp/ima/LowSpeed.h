@@ -36,7 +36,6 @@ namespace safetyapp {
 namespace ima {
 class LowSpeed final : public Interface {
 public:
-    LowSpeed(bool const approachingIntersection);
     void attack(veins::BasicSafetyMessage* bsm) override;
 };
 } // namespace ima
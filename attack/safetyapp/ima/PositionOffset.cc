@@ -34,15 +34,10 @@ namespace attack {
 namespace safetyapp {
 namespace ima {
 
-PositionOffset::PositionOffset(bool const approachingIntersection)
-{
-    approachingIntersection_ = approachingIntersection;
-}
-
 void PositionOffset::attack(veins::BasicSafetyMessage* bsm)
 {
     if (approachingIntersection_) {
-        bsm->setAttackType("IMAPositionOffset");
+        markAttacked(bsm, kFieldPosition);
         bsm->setSenderPos(bsm->getSenderPos() + bsm->getHeading().toCoord() * 100);
     }
 }
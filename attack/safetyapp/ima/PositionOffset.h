@@ -36,7 +36,6 @@ namespace safetyapp {
 namespace ima {
 class PositionOffset final : public Interface {
 public:
-    PositionOffset(bool const approachingIntersection);
     void attack(veins::BasicSafetyMessage* bsm) override;
 };
 } // namespace ima
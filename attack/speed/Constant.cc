@@ -34,7 +34,7 @@ namespace attack {
 namespace speed {
 void Constant::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("ConstantSpeed");
+    markAttacked(bsm, kFieldSpeed);
     bsm->setSenderSpeed(bsm->getHeading().toCoord() * 5);
 }
 } // namespace speed
@@ -39,7 +39,7 @@ ConstantOffset::ConstantOffset(double const offset)
 
 void ConstantOffset::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("ConstantSpeedOffset");
+    markAttacked(bsm, kFieldSpeed);
     bsm->setSenderSpeed(bsm->getSenderSpeed() + veins::Coord(offset_, offset_));
 }
 } // namespace speed
@@ -34,7 +34,7 @@ namespace attack {
 namespace speed {
 void High::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("HighSpeed");
+    markAttacked(bsm, kFieldSpeed);
 
     // maximal speed as defined in ETSI TS 102 894-2: 163.82m/s
     bsm->setSenderSpeed(bsm->getHeading().toCoord() * 163.83);
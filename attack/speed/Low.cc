@@ -34,7 +34,7 @@ namespace attack {
 namespace speed {
 void Low::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("LowSpeed");
+    markAttacked(bsm, kFieldSpeed);
 
     // minimal speed as defined in ETSI TS 102 894-2: 0m/s
     bsm->setSenderSpeed(bsm->getHeading().toCoord() * -0.1);
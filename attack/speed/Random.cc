@@ -36,7 +36,7 @@ namespace attack {
 namespace speed {
 void Random::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RandomSpeed");
+    markAttacked(bsm, kFieldSpeed);
 
     auto rng = getEnvir()->getRNG(0);
     bsm->setSenderSpeed(veins::Coord(uniform(rng, -INFINITY, INFINITY), uniform(rng, -INFINITY, INFINITY)));
@@ -41,7 +41,7 @@ RandomOffset::RandomOffset(double const offset)
 
 void RandomOffset::attack(veins::BasicSafetyMessage* bsm)
 {
-    bsm->setAttackType("RandomSpeedOffset");
+    markAttacked(bsm, kFieldSpeed);
 
     auto rng = getEnvir()->getRNG(0);
     bsm->setSenderSpeed(bsm->getSenderSpeed() + veins::Coord(uniform(rng, -offset_, offset_), uniform(rng, -offset_, offset_)));
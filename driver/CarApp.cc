@@ -26,10 +26,13 @@
  * Email: quic_ransari@quicinc.com
  */
 
+#include <algorithm>
 #include <CSVWriter.h>
+#include <omnetpp/cstringtokenizer.h>
 #include <vasp/connection/Manager.h>
 #include <vasp/driver/CarApp.h>
 #include <vasp/logging/TraceManager.h>
+#include <vasp/map/MapManager.h>
 #include <vasp/messages/BasicSafetyMessage_m.h>
 
 // V2X Applications
@@ -37,97 +40,67 @@
 #include <vasp/safetyapps/IMA.h>
 
 // attacks
+#include <vasp/attack/Pipeline.h>
+#include <vasp/attack/Registry.h>
 #include <vasp/attack/Type.h>
-#include <vasp/attack/dimension/Type.h>
-#include <vasp/attack/heading/Type.h>
-// ghost vehicle based attacks
-#include <vasp/attack/mobility/CommRangeBraking.h>
-#include <vasp/attack/position/ghost_vehicle/SuddenAppearance.h>
-#include <vasp/attack/position/ghost_vehicle/TargetedConstantPosition.h>
-#include <vasp/attack/safetyapp/eebl/JustAttack.h>
-#include <vasp/attack/safetyapp/eebl/StopAfterAttack.h>
-// self telemetry based attacks
-#include <vasp/attack/acceleration/Constant.h>
-#include <vasp/attack/acceleration/ConstantOffset.h>
-#include <vasp/attack/acceleration/High.h>
-#include <vasp/attack/acceleration/Low.h>
-#include <vasp/attack/acceleration/Random.h>
-#include <vasp/attack/acceleration/RandomOffset.h>
-#include <vasp/attack/channel/DenialOfService.h>
-#include <vasp/attack/dimension/BadRatio.h>
-#include <vasp/attack/dimension/ConstantOffset.h>
-#include <vasp/attack/dimension/High.h>
-#include <vasp/attack/dimension/Low.h>
-#include <vasp/attack/dimension/Random.h>
-#include <vasp/attack/dimension/RandomOffset.h>
-#include <vasp/attack/heading/Constant.h>
-#include <vasp/attack/heading/ConstantOffset.h>
-#include <vasp/attack/heading/High.h>
-#include <vasp/attack/heading/Low.h>
-#include <vasp/attack/heading/Opposite.h>
-#include <vasp/attack/heading/Perpendicular.h>
-#include <vasp/attack/heading/Random.h>
-#include <vasp/attack/heading/RandomOffset.h>
-#include <vasp/attack/heading/Rotating.h>
-#include <vasp/attack/position/self_telemetry/ConstantOffset.h>
-#include <vasp/attack/position/self_telemetry/PlaygroundConstantPosition.h>
-#include <vasp/attack/position/self_telemetry/Random.h>
-#include <vasp/attack/position/self_telemetry/RandomOffset.h>
-#include <vasp/attack/position/self_telemetry/SuddenDisappearance.h>
-#include <vasp/attack/safetyapp/ima/HighAcceleration.h>
-#include <vasp/attack/safetyapp/ima/HighSpeed.h>
-#include <vasp/attack/safetyapp/ima/JunctionPosition.h>
-#include <vasp/attack/safetyapp/ima/LowAcceleration.h>
-#include <vasp/attack/safetyapp/ima/LowSpeed.h>
-#include <vasp/attack/safetyapp/ima/PositionOffset.h>
-#include <vasp/attack/speed/Constant.h>
-#include <vasp/attack/speed/ConstantOffset.h>
-#include <vasp/attack/speed/High.h>
-#include <vasp/attack/speed/Low.h>
-#include <vasp/attack/speed/Random.h>
-#include <vasp/attack/speed/RandomOffset.h>
 
 namespace vasp {
 namespace driver {
 
+namespace {
+attack::Target toTarget(veins::BasicSafetyMessage const* rvBsm)
+{
+    attack::Target target{};
+    target.address = rvBsm->getAddress();
+    target.position = rvBsm->getSenderPos();
+    target.speed = rvBsm->getSenderSpeed();
+    target.heading = rvBsm->getHeading();
+    return target;
+}
+} // namespace
+
 Define_Module(CarApp);
 
+CarApp::~CarApp()
+{
+    cancelAndDelete(dosEvt_);
+}
+
 void CarApp::initialize(int stage)
 {
     DemoBaseApplLayer::initialize(stage);
 
     if (stage == 0) {
         attackType_ = par("attackType");
+        // a pipeline replaces the single attack type
+        if (par("attackPipeline").stdstringValue() != "") {
+            attackType_ = attack::kAttackPipeline;
+        }
+        else if (attackType_ == attack::kAttackPipeline) {
+            throw cRuntimeError("attackType %d needs the attack types of the pipeline in attackPipeline", attackType_);
+        }
         maliciousProbability_ = attackType_ == attack::kAttackNo ? 0.0 : par("maliciousProbability");
         bsmData_ = par("bsmData").stdstringValue();
         simRunID_ = par("runID").stdstringValue();
         resultDir_ = par("resultDir").stdstringValue();
-        mapFile_ = par("mapFile").stdstringValue();
+        junctionSearchRadius_ = par("junctionSearchRadius");
+
+        // vehicle dimensions are fixed once the vehicle is inserted
+        length_ = traciVehicle->getLength();
+        width_ = traciVehicle->getWidth();
+        height_ = traciVehicle->getHeight();
+        // the three queries above are the only ones left of the per-BSM queries
+        dimensionCallsSaved_ = -3;
     }
 
     if (stage == 1) {
         world_ = veins::FindModule<veins::BaseWorldUtility*>::findGlobalModule();
         connManager_ = veins::FindModule<connection::Manager*>::findGlobalModule();
         traceManager_ = veins::FindModule<logging::TraceManager*>::findGlobalModule();
+        auto mapManager = veins::FindModule<map::MapManager*>::findGlobalModule();
 
-        ghostVehicleDistance_ = connManager_->getInterfDist();
-
-        // Load MAP
-        std::ifstream mapFileStream{mapFile_};
-        std::stringstream buffer{};
-        if (mapFileStream) {
-            buffer << mapFileStream.rdbuf();
-            mapFileStream.close();
-        }
-        else {
-            std::string errorMsg = "Unable to open map JSON file: \"" + mapFile_ + "\"";
-            throw cRuntimeError(errorMsg.c_str());
-        }
-        mapJson_ = json::parse(buffer);
-
-        // start IMA
-        runIMA_ = std::make_shared<cMessage>("runIMA");
-        scheduleAt(simTime() + 2, runIMA_.get());
+        // MAP is loaded once by the MapManager and shared by all vehicles
+        junctionMap_ = mapManager->getMap();
 
         isMalicious_ = maliciousProbability_ >= dblrand();
 
@@ -136,13 +109,23 @@ void CarApp::initialize(int stage)
             return;
         }
         attackPolicy_ = static_cast<attack::AttackPolicy>(par("attackPolicy").intValue());
-        posAttackOffset_ = par("posAttackOffset");
-        dimensionAttackOffset_ = par("dimensionAttackOffset");
-        headingAttackOffset_ = par("headingAttackOffset");
-        yawRateAttackOffset_ = par("yawRateAttackOffset");
-        accelerationAttackOffset_ = par("accelerationAttackOffset");
-        speedAttackOffset_ = par("speedAttackOffset");
-        nDosMessages_ = par("nDosMessages");
+        attackParameters_.world = world_;
+        attackParameters_.posOffset = par("posAttackOffset");
+        attackParameters_.dimensionOffset = par("dimensionAttackOffset");
+        attackParameters_.yawRateOffset = par("yawRateAttackOffset");
+        attackParameters_.accelerationOffset = par("accelerationAttackOffset");
+        attackParameters_.speedOffset = par("speedAttackOffset");
+        attackParameters_.ghostDistance = connManager_->getInterfDist();
+        ghostIdleTimeout_ = par("ghostIdleTimeout");
+        auto const ghostEmissionPolicy = par("ghostEmissionPolicy").intValue();
+        if (ghostEmissionPolicy < attack::kGhostEmissionPerBsm or ghostEmissionPolicy > attack::kGhostEmissionTotal) {
+            throw cRuntimeError("ghostEmissionPolicy should be 0, 1 or 2; invalid input: %d", static_cast<int>(ghostEmissionPolicy));
+        }
+        ghostEmissionPolicy_ = static_cast<attack::GhostEmissionPolicy>(ghostEmissionPolicy);
+        maxGhostsPerInterval_ = par("maxGhostsPerInterval");
+        if (ghostEmissionPolicy_ != attack::kGhostEmissionPerBsm and maxGhostsPerInterval_ < 1) {
+            throw cRuntimeError("maxGhostsPerInterval should be at least 1; invalid input: %d", maxGhostsPerInterval_);
+        }
 
         // handle random attack insertion
         sporadicInsertionRate_ = attackPolicy_ == attack::kAttackPolicySporadic ? par("sporadicInsertionRate") : 0.0;
@@ -154,7 +137,33 @@ void CarApp::initialize(int stage)
 
         // handle attack type selection if random attack selection
         if (attackType_ == attack::kAttackRandomlySelectedAttack) {
-            attackType_ = static_cast<int>(uniform(attack::_kAttackMinValue + 1, attack::_kAttackMaxValue + 1));
+            attackType_ = drawAttackType();
+        }
+
+        if (par("attackPipeline").stdstringValue() != "") {
+            auto pipeline = std::make_unique<attack::Pipeline>();
+            pipeline->setAttackType(attack::kAttackPipeline);
+            for (auto const type : cStringTokenizer{par("attackPipeline").stringValue(), " ,"}.asIntVector()) {
+                // SuddenDisappearance deletes the BSM, so no stage could follow it
+                if (attack::getRegistration(type).category != attack::kCategorySelfTelemetry or type == attack::kAttackSuddenDisappearance) {
+                    throw cRuntimeError("attackPipeline only takes self telemetry attacks other than SuddenDisappearance; invalid input: %d", type);
+                }
+                pipeline->addStage(attack::create(type, attackParameters_));
+            }
+            if (pipeline->empty()) {
+                throw cRuntimeError("attackPipeline has no attack types: \"%s\"", par("attackPipeline").stringValue());
+            }
+            attackPool_[attack::kAttackPipeline] = std::move(pipeline);
+        }
+
+        // ghost vehicle attacks are fixed for the whole run
+        if (attack::getRegistration(attackType_).category == attack::kCategoryGhost) {
+            ghostAttack_ = attack::create(attackType_, attackParameters_);
+        }
+
+        // channel attacks flood on their own schedule for the whole run
+        if (attack::getRegistration(attackType_).category == attack::kCategoryChannel) {
+            startFlooding();
         }
     }
 }
@@ -162,25 +171,35 @@ void CarApp::initialize(int stage)
 void CarApp::finish()
 {
     DemoBaseApplLayer::finish();
-    cancelEvent(runIMA_.get());
+
+    recordScalar("traciDimensionCallsSaved", dimensionCallsSaved_);
+    if (dosAttack_) {
+        recordScalar("dosMessagesSent", dosMessagesSent_);
+    }
+    if (ghostAttack_) {
+        recordScalar("ghostsSent", ghostsSent_);
+        recordScalar("ghostsSuppressed", ghostsSuppressed_);
+        recordScalar("ghostTableEvictions", ghostEvictions_);
+        recordScalar("ghostTablePeakSize", ghostTablePeakSize_);
+    }
 }
 
 void CarApp::handleSelfMsg(cMessage* msg)
 {
-    if (msg == runIMA_.get()) {
-        runIMA();
-        scheduleAt(simTime() + 2, runIMA_.get());
-    }
-
     if (msg == sendBeaconEvt) {
         veins::BasicSafetyMessage* hvBsm = new veins::BasicSafetyMessage();
         populateWSM(hvBsm);
+        traceManager_->logHostState(hvBsm);
 
         if (isMalicious_) {
             int tmpAttackType{-1};
             if (attackType_ == attack::kAttackAlwaysRandomAttack) {
                 tmpAttackType = attackType_;
-                attackType_ = static_cast<int>(uniform(attack::_kAttackMinValue + 1, attack::_kAttackMaxValue + 1));
+                attackType_ = drawAttackType();
+                // once drawn, flooding keeps running next to the later beacons
+                if (attack::getRegistration(attackType_).category == attack::kCategoryChannel and !dosAttack_) {
+                    startFlooding();
+                }
             }
 
             if ((attackPolicy_ == attack::kAttackPolicyPersistent) or // always attack
@@ -192,16 +211,24 @@ void CarApp::handleSelfMsg(cMessage* msg)
             prevBeaconTime_ = simTime();
             if (attackType_ != attack::kAttackSuddenDisappearance) {
                 prevHvHeading_ = hvBsm->getHeading();
+                traceManager_->logTransmission(hvBsm);
                 sendDown(hvBsm);
             }
             attackType_ = tmpAttackType != -1 ? tmpAttackType : attackType_;
+
+            sendQueuedGhosts();
         }
         else {
+            traceManager_->logTransmission(hvBsm);
             sendDown(hvBsm);
         }
         scheduleAt(simTime() + beaconInterval, sendBeaconEvt);
     }
 
+    if (msg == dosEvt_) {
+        floodChannel();
+    }
+
     if (msg == sendWSAEvt) {
         veins::DemoServiceAdvertisment* wsa = new veins::DemoServiceAdvertisment();
         populateWSM(wsa);
@@ -219,33 +246,91 @@ void CarApp::populateWSM(veins::BaseFrame1609_4* wsm, veins::LAddress::L2Type rc
         bsm->setMsgGenerationTime(simTime().dbl());
         bsm->setAddress(myId);
         bsm->setRecipientId(rcvId);
-        bsm->setAttackType("Genuine");
+        bsm->setAttackType(attack::kAttackNo);
+        bsm->setMutatedFields(attack::kFieldNone);
+        bsm->setGhost(false);
         bsm->setData(bsmData_.c_str());
-        bsm->setHeading(mobility->getHeading());
+        auto const& hostState = getHostState();
+        bsm->setHeading(hostState.heading);
         bsm->setYawRate(curYawRate_);
-        bsm->setLength(traciVehicle->getLength());
-        bsm->setWidth(traciVehicle->getWidth());
-        bsm->setHeight(traciVehicle->getHeight());
-
-        double const acceleration{traciVehicle->getAcceleration()};
-        bsm->setAcceleration(acceleration);
+        bsm->setLength(hostState.length);
+        bsm->setWidth(hostState.width);
+        bsm->setHeight(hostState.height);
+        // length, width and height used to be queried from TraCI for every BSM
+        dimensionCallsSaved_ += 3;
+        bsm->setAcceleration(hostState.acceleration);
 
         // AASHTO defines hard braking as a deceleration greater than 4.5 m/s^2
         double constexpr kDecelerationThreshold{-4.5}; // m/s^2
-        bsm->setEventHardBraking(acceleration < kDecelerationThreshold);
+        bsm->setEventHardBraking(hostState.acceleration < kDecelerationThreshold);
+    }
+}
+
+CarApp::HostState const& CarApp::getHostState()
+{
+    // all BSMs received, sent or traced in one time step share one query
+    if (hostState_.time != simTime()) {
+        hostState_.time = simTime();
+        hostState_.position = mobility->getPositionAt(simTime());
+        hostState_.speed = mobility->getHostSpeed();
+        hostState_.heading = mobility->getHeading();
+        hostState_.acceleration = curAcceleration_;
+        hostState_.length = length_;
+        hostState_.width = width_;
+        hostState_.height = height_;
+    }
+    return hostState_;
+}
+
+veins::BasicSafetyMessage const* CarApp::getHostStateBsm()
+{
+    if (hostStateBsmTime_ != simTime()) {
+        // populateWSM() adds the beacon length on top of the current length
+        hostStateBsm_.setBitLength(0);
+        populateWSM(&hostStateBsm_);
+        hostStateBsmTime_ = simTime();
     }
+    return &hostStateBsm_;
 }
 
 void CarApp::handlePositionUpdate(cObject* obj)
 {
     DemoBaseApplLayer::handlePositionUpdate(obj);
 
+    // the host vehicle moved, BSMs handled later in this time step need the new state
+    hostState_.time = -1;
+    hostStateBsmTime_ = -1;
+
+    // IMA state only changes when the vehicle moves onto another road, unless
+    // the road is missing from the map and the nearest junction is tracked instead
+    auto const roadId = mobility->getRoadId();
+    if (roadId != currentRoadId_) {
+        currentRoadId_ = roadId;
+        roadJunction_ = junctionMap_->findJunction(currentRoadId_);
+        runIMA();
+    }
+    else if (roadJunction_ == nullptr and junctionSearchRadius_ > 0) {
+        runIMA();
+    }
+
+    // speed arrives with the position subscription; SUMO reports acceleration
+    // as the speed change over the last step, so derive it here instead of
+    // issuing a blocking TraCI query per beacon
+    auto const hostSpeed{mobility->getSpeed()};
     if (lastUpdate_ == -1.0) {
         lastUpdate_ = simTime();
+        lastSpeed_ = hostSpeed;
         return;
     }
 
     auto const updateInterval{simTime() - lastUpdate_};
+    if (updateInterval <= 0) {
+        return;
+    }
+
+    // calculate acceleration
+    curAcceleration_ = (hostSpeed - lastSpeed_) / updateInterval.dbl();
+    lastSpeed_ = hostSpeed;
 
     // calculate yaw rate
     auto const curAngleRad{mobility->getHeading().getRad()};
@@ -256,358 +341,102 @@ void CarApp::handlePositionUpdate(cObject* obj)
     lastUpdate_ = simTime();
 }
 
-void CarApp::injectAttack(veins::BasicSafetyMessage* hvBsm)
+attack::BeaconContext CarApp::getBeaconContext(attack::Target const* target)
 {
-    using namespace vasp::attack;
+    attack::BeaconContext context{};
+    context.prevHeading = prevHvHeading_;
+    context.prevBeaconTime = prevBeaconTime_;
+    context.approachingIntersection = approachingIntersection_;
+    context.junctionPos = junctionPos_;
+    context.hostSpeed = getHostState().speed;
+    context.target = target;
+    return context;
+}
 
+void CarApp::injectAttack(veins::BasicSafetyMessage* hvBsm)
+{
     if (generatedBSMs == 0) {
         prevHvHeading_ = hvBsm->getHeading();
     }
 
-    // Select attack according to the attackType_
-    // do nothing if NoAttacks or any one of the ghost attacks is selected
-    switch (attackType_) {
-    case attack::kAttackPlaygroundConstantPosition: {
-        attack_ = std::make_unique<position::PlaygroundConstantPosition>(world_);
-        break;
-    }
-    case attack::kAttackConstantPositionOffset: {
-        attack_ = std::make_unique<position::ConstantOffset>(posAttackOffset_);
-        break;
-    }
-    case attack::kAttackRandomPosition: {
-        attack_ = std::make_unique<position::Random>(world_);
-        break;
-    }
-    case attack::kAttackRandomPositionOffset: {
-        attack_ = std::make_unique<position::RandomOffset>(posAttackOffset_);
-        break;
-    }
-    case attack::kAttackSuddenDisappearance: {
-        attack_ = std::make_unique<position::SuddenDisappearance>();
-        break;
-    }
-    case attack::kAttackDenialOfService: {
-        attack_ = std::make_unique<channel::DenialOfService>(beaconInterval, nDosMessages_);
-        break;
-    }
-    case attack::kAttackIMAPosOffset: {
-        attack_ = std::make_unique<safetyapp::ima::PositionOffset>(approachingIntersection_);
-        break;
-    }
-    case attack::kAttackIMAJunctionPos: {
-        attack_ = std::make_unique<safetyapp::ima::JunctionPosition>(approachingIntersection_, junctionPos_);
-        break;
-    }
-    case attack::kAttackIMAHighSpeed: {
-        attack_ = std::make_unique<safetyapp::ima::HighSpeed>(approachingIntersection_);
-        break;
-    }
-    case attack::kAttackIMALowSpeed: {
-        attack_ = std::make_unique<safetyapp::ima::LowSpeed>(approachingIntersection_);
-        break;
-    }
-    case attack::kAttackIMAHighAcceleration: {
-        attack_ = std::make_unique<safetyapp::ima::HighAcceleration>(approachingIntersection_);
-        break;
-    }
-    case attack::kAttackIMALowAcceleration: {
-        attack_ = std::make_unique<safetyapp::ima::LowAcceleration>(approachingIntersection_);
-        break;
-    }
-    // Dimension attacks
-    case attack::kAttackHighDimension: {
-        auto highDimension = std::make_unique<dimension::High>();
-        highDimension->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(highDimension);
-        break;
-    }
-    case attack::kAttackLowDimension: {
-        auto lowDimension = std::make_unique<dimension::Low>();
-        lowDimension->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(lowDimension);
-        break;
-    }
-    case attack::kAttackRandomDimension: {
-        auto randomDimension = std::make_unique<dimension::Random>();
-        randomDimension->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(randomDimension);
-        break;
-    }
-    case attack::kAttackRandomDimensionOffset: {
-        auto randomDimensionOffset = std::make_unique<dimension::RandomOffset>();
-        randomDimensionOffset->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(randomDimensionOffset);
-        break;
-    }
-    case attack::kAttackConstantDimensionOffset: {
-        auto constantDimensionOffset = std::make_unique<dimension::ConstantOffset>();
-        constantDimensionOffset->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(constantDimensionOffset);
-        break;
-    }
-    case attack::kAttackBadRatioDimension: {
-        auto badRatioDimension = std::make_unique<dimension::BadRatio>();
-        badRatioDimension->setType(dimension::kDimensionAttackTypeBoth);
-        attack_ = std::move(badRatioDimension);
-        break;
-    }
-    // Length attacks
-    case attack::kAttackHighLength: {
-        auto highLength = std::make_unique<dimension::High>();
-        highLength->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(highLength);
-        break;
-    }
-    case attack::kAttackLowLength: {
-        auto lowLength = std::make_unique<dimension::Low>();
-        lowLength->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(lowLength);
-        break;
-    }
-    case attack::kAttackRandomLength: {
-        auto randomLength = std::make_unique<dimension::Random>();
-        randomLength->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(randomLength);
-        break;
-    }
-    case attack::kAttackRandomLengthOffset: {
-        auto randomLengthOffset = std::make_unique<dimension::RandomOffset>();
-        randomLengthOffset->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(randomLengthOffset);
-        break;
-    }
-    case attack::kAttackConstantLengthOffset: {
-        auto constantLengthOffset = std::make_unique<dimension::ConstantOffset>();
-        constantLengthOffset->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(constantLengthOffset);
-        break;
-    }
-    case attack::kAttackBadRatioLength: {
-        auto badRatioLength = std::make_unique<dimension::BadRatio>();
-        badRatioLength->setType(dimension::kDimensionAttackTypeLength);
-        attack_ = std::move(badRatioLength);
-        break;
-    }
-    // Width attacks
-    case attack::kAttackHighWidth: {
-        auto highWidth = std::make_unique<dimension::High>();
-        highWidth->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(highWidth);
-        break;
-    }
-    case attack::kAttackLowWidth: {
-        auto lowWidth = std::make_unique<dimension::Low>();
-        lowWidth->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(lowWidth);
-        break;
-    }
-    case attack::kAttackRandomWidth: {
-        auto randomWidth = std::make_unique<dimension::Random>();
-        randomWidth->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(randomWidth);
-        break;
-    }
-    case attack::kAttackRandomWidthOffset: {
-        auto randomWidthOffset = std::make_unique<dimension::RandomOffset>();
-        randomWidthOffset->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(randomWidthOffset);
-        break;
-    }
-    case attack::kAttackConstantWidthOffset: {
-        auto constantWidthOffset = std::make_unique<dimension::ConstantOffset>();
-        constantWidthOffset->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(constantWidthOffset);
-        break;
-    }
-    case attack::kAttackBadRatioWidth: {
-        auto badRatioWidth = std::make_unique<dimension::BadRatio>();
-        badRatioWidth->setType(dimension::kDimensionAttackTypeWidth);
-        attack_ = std::move(badRatioWidth);
-        break;
-    }
-    // Heading attacks
-    case attack::kAttackOppositeHeading: {
-        attack_ = std::make_unique<heading::Opposite>();
-        break;
-    }
-    case attack::kAttackPerpendicularHeading: {
-        attack_ = std::make_unique<heading::Perpendicular>();
-        break;
-    }
-    case attack::kAttackRotatingHeading: {
-        attack_ = std::make_unique<heading::Rotating>();
-        break;
-    }
-    case attack::kAttackConstantHeading: {
-        auto constantHeading = std::make_unique<heading::Constant>();
-        constantHeading->setType(heading::kHyraTypeHeading);
-        constantHeading->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantHeading);
-        break;
-    }
-    case attack::kAttackRandomHeading: {
-        auto randomHeading = std::make_unique<heading::Random>();
-        randomHeading->setType(heading::kHyraTypeHeading);
-        randomHeading->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomHeading);
-        break;
-    }
-    case attack::kAttackRandomHeadingOffset: {
-        auto randomHeadingOffset = std::make_unique<heading::RandomOffset>();
-        randomHeadingOffset->setType(heading::kHyraTypeHeading);
-        randomHeadingOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomHeadingOffset);
-        break;
-    }
-    case attack::kAttackConstantHeadingOffset: {
-        auto constantHeadingOffset = std::make_unique<heading::ConstantOffset>();
-        constantHeadingOffset->setType(heading::kHyraTypeHeading);
-        constantHeadingOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantHeadingOffset);
-        break;
-    }
-
-    // Yaw-rate attacks
-    case attack::kAttackHighYawRate: {
-        auto highYawRate = std::make_unique<heading::High>();
-        highYawRate->setType(heading::kHyraTypeYawRate);
-        highYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(highYawRate);
-        break;
-    }
-    case attack::kAttackLowYawRate: {
-        auto lowYawRate = std::make_unique<heading::Low>();
-        lowYawRate->setType(heading::kHyraTypeYawRate);
-        lowYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(lowYawRate);
-        break;
-    }
-    case attack::kAttackConstantYawRate: {
-        auto constantYawRate = std::make_unique<heading::Constant>();
-        constantYawRate->setType(heading::kHyraTypeYawRate);
-        constantYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantYawRate);
-        break;
-    }
-    case attack::kAttackRandomYawRate: {
-        auto randomYawRate = std::make_unique<heading::Random>();
-        randomYawRate->setType(heading::kHyraTypeYawRate);
-        randomYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomYawRate);
-        break;
-    }
-    case attack::kAttackRandomYawRateOffset: {
-        auto randomYawRateOffset = std::make_unique<heading::RandomOffset>();
-        randomYawRateOffset->setType(heading::kHyraTypeYawRate);
-        randomYawRateOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomYawRateOffset);
-        break;
-    }
-    case attack::kAttackConstantYawRateOffset: {
-        auto constantYawRateOffset = std::make_unique<heading::ConstantOffset>();
-        constantYawRateOffset->setType(heading::kHyraTypeYawRate);
-        constantYawRateOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantYawRateOffset);
-        break;
-    }
-
-    // Heading and Yaw-rate matching attacks
-    case attack::kAttackHighHeadingYawRate: {
-        auto highHeadingYawRate = std::make_unique<heading::High>();
-        highHeadingYawRate->setType(heading::kHyraTypeBoth);
-        highHeadingYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(highHeadingYawRate);
-        break;
-    }
-    case attack::kAttackLowHeadingYawRate: {
-        auto lowHeadingYawRate = std::make_unique<heading::Low>();
-        lowHeadingYawRate->setType(heading::kHyraTypeBoth);
-        lowHeadingYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(lowHeadingYawRate);
-        break;
-    }
-    case attack::kAttackConstantHeadingYawRate: {
-        auto constantHeadingYawRate = std::make_unique<heading::Constant>();
-        constantHeadingYawRate->setType(heading::kHyraTypeBoth);
-        constantHeadingYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantHeadingYawRate);
-        break;
-    }
-    case attack::kAttackRandomHeadingYawRate: {
-        auto randomHeadingYawRate = std::make_unique<heading::Random>();
-        randomHeadingYawRate->setType(heading::kHyraTypeBoth);
-        randomHeadingYawRate->update(prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomHeadingYawRate);
-        break;
-    }
-    case attack::kAttackRandomHeadingYawRateOffset: {
-        auto randomHeadingYawRateOffset = std::make_unique<heading::RandomOffset>();
-        randomHeadingYawRateOffset->setType(heading::kHyraTypeBoth);
-        randomHeadingYawRateOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(randomHeadingYawRateOffset);
-        break;
-    }
-    case attack::kAttackConstantHeadingYawRateOffset: {
-        auto constantHeadingYawRateOffset = std::make_unique<heading::ConstantOffset>();
-        constantHeadingYawRateOffset->setType(heading::kHyraTypeBoth);
-        constantHeadingYawRateOffset->update(yawRateAttackOffset_, prevHvHeading_, prevBeaconTime_);
-        attack_ = std::move(constantHeadingYawRateOffset);
-        break;
-    }
-    case attack::kAttackHighAcceleration: {
-        attack_ = std::make_unique<acceleration::High>();
-        break;
-    }
-    case attack::kAttackLowAcceleration: {
-        attack_ = std::make_unique<acceleration::Low>();
-        break;
-    }
-    case attack::kAttackConstantAcceleration: {
-        attack_ = std::make_unique<acceleration::Constant>();
-        break;
-    }
-    case attack::kAttackRandomAcceleration: {
-        attack_ = std::make_unique<acceleration::Random>();
-        break;
-    }
-    case attack::kAttackRandomAccelerationOffset: {
-        attack_ = std::make_unique<acceleration::RandomOffset>(accelerationAttackOffset_);
-        break;
-    }
-    case attack::kAttackConstantAccelerationOffset: {
-        attack_ = std::make_unique<acceleration::ConstantOffset>(accelerationAttackOffset_);
-        break;
-    }
-    case attack::kAttackHighSpeed: {
-        attack_ = std::make_unique<speed::High>();
-        break;
-    }
-    case attack::kAttackLowSpeed: {
-        attack_ = std::make_unique<speed::Low>();
-        break;
-    }
-    case attack::kAttackConstantSpeed: {
-        attack_ = std::make_unique<speed::Constant>();
-        break;
-    }
-    case attack::kAttackRandomSpeed: {
-        attack_ = std::make_unique<speed::Random>();
-        break;
-    }
-    case attack::kAttackRandomSpeedOffset: {
-        attack_ = std::make_unique<speed::RandomOffset>(speedAttackOffset_);
-        break;
-    }
-    case attack::kAttackConstantSpeedOffset: {
-        attack_ = std::make_unique<speed::ConstantOffset>(speedAttackOffset_);
-        break;
-    }
-    }
-
-    if (attack_) {
-        attack_->attack(hvBsm);
+    // each attack type is created on its first use and reused for all later beacons;
+    // a pipeline is assembled in initialize()
+    auto& instance = attackPool_[attackType_];
+    if (!instance) {
+        // nothing to do if NoAttacks or any one of the ghost attacks is selected
+        if (attack::getRegistration(attackType_).category != attack::kCategorySelfTelemetry) {
+            return;
+        }
+        instance = attack::create(attackType_, attackParameters_);
     }
+    instance->update(getBeaconContext());
+    instance->attack(hvBsm);
+}
+
+void CarApp::startFlooding()
+{
+    dosRate_ = par("dosRate");
+    if (dosRate_ == 0) {
+        int const nDosMessages = par("nDosMessages");
+        dosRate_ = nDosMessages / beaconInterval.dbl();
+    }
+    double const dutyCycle = par("dosDutyCycle");
+    dosBurstLength_ = par("dosBurstLength");
+    dosStartTime_ = par("dosStartTime");
+    dosStopTime_ = par("dosStopTime");
+    if (dosRate_ <= 0) {
+        throw cRuntimeError("dosRate should be positive; invalid input: %g", dosRate_);
+    }
+    if (dutyCycle <= 0 or dutyCycle > 1) {
+        throw cRuntimeError("dosDutyCycle should be within range (0, 1]; invalid input: %g", dutyCycle);
+    }
+    if (dosBurstLength_ < 0) {
+        throw cRuntimeError("dosBurstLength should not be negative; invalid input: %g", dosBurstLength_.dbl());
+    }
+    dosBurstPeriod_ = dosBurstLength_.dbl() / dutyCycle;
+
+    dosAttack_ = attack::create(attack::kAttackDenialOfService, attackParameters_);
+    dosEvt_ = new cMessage("dos flood");
+    scheduleDosMessage(simTime());
+}
+
+void CarApp::floodChannel()
+{
+    auto dosBsm = new veins::BasicSafetyMessage();
+    populateWSM(dosBsm);
+    dosAttack_->attack(dosBsm);
+    traceManager_->logTransmission(dosBsm);
+    sendDown(dosBsm);
+    dosMessagesSent_++;
+
+    scheduleDosMessage(simTime() + 1 / dosRate_);
+}
+
+void CarApp::scheduleDosMessage(simtime_t sendTime)
+{
+    if (sendTime < dosStartTime_) {
+        sendTime = dosStartTime_;
+    }
+
+    // bursts of dosBurstLength_ start every dosBurstPeriod_ after dosStartTime_
+    if (dosBurstLength_ > 0) {
+        auto const phase = simtime_t().setRaw((sendTime - dosStartTime_).raw() % dosBurstPeriod_.raw());
+        if (phase >= dosBurstLength_) {
+            sendTime = sendTime - phase + dosBurstPeriod_;
+        }
+    }
+
+    if (dosStopTime_ >= 0 and sendTime > dosStopTime_) {
+        return;
+    }
+    scheduleAt(sendTime, dosEvt_);
+}
+
+int CarApp::drawAttackType()
+{
+    // only types with an attack, never NoAttacks, the random selections themselves or a pipeline
+    auto const& types = attack::getSelectableTypes();
+    return types[intrand(static_cast<int>(types.size()))];
 }
 
 void CarApp::onBSM(veins::DemoSafetyMessage* dsm)
@@ -621,14 +450,19 @@ void CarApp::onBSM(veins::DemoSafetyMessage* dsm)
 
     if (isMalicious_) {
         // if a BSM is a ghost BSM then don't attack
-        if (strcmp("ghost", rvBsm->getData()) == 0) {
+        if (rvBsm->getGhost()) {
             return;
         }
 
         if (attackPolicy_ == attack::kAttackPolicyPersistent or // always attack
             sporadicInsertionRate_ >= dblrand() // sporadic attack
         ) {
-            injectGhostAttack(rvBsm);
+            if (ghostEmissionPolicy_ == attack::kGhostEmissionPerBsm) {
+                injectGhostAttack(toTarget(rvBsm));
+            }
+            else {
+                queueGhostTarget(rvBsm);
+            }
         }
 
         return;
@@ -638,110 +472,154 @@ void CarApp::onBSM(veins::DemoSafetyMessage* dsm)
     writeTrace(rvBsm, rvBsmReceiveTime);
 }
 
-void CarApp::setUniqueGhostAddress(std::string const& key, veins::BasicSafetyMessage* ghostBsm)
+void CarApp::queueGhostTarget(veins::BasicSafetyMessage const* rvBsm)
 {
-    // set random, trackable and possibly unique ID for ghost
-    if (ghostRvIdMap_.find(key) == ghostRvIdMap_.end()) {
-        ghostRvIdMap_[key] = intrand(INT_MAX);
+    if (!ghostAttack_) {
+        return;
     }
-    ghostBsm->setAddress(ghostRvIdMap_[key]);
-}
 
-void CarApp::setGhostMsgCount(std::string const& key, veins::BasicSafetyMessage* ghostBsm)
-{
-    // track message count per remote vehicle
-    if (ghostMsgCountMap_.find(key) == ghostMsgCountMap_.end()) {
-        ghostMsgCountMap_[key] = 0;
+    // keep only the latest state of each target, ghosts are sent with the next beacon
+    auto& ghost = getGhost(rvBsm->getAddress());
+    if (ghost.pending < 0) {
+        ghost.pending = static_cast<int>(ghostTargets_.size());
+        ghostTargets_.push_back(GhostTarget{toTarget(rvBsm), 0, 0});
     }
     else {
-        ghostMsgCountMap_[key] %= 128; // message count should not go beyond 127
+        ghostTargets_[ghost.pending].target = toTarget(rvBsm);
     }
-    ghostBsm->setMsgCount(ghostMsgCountMap_[key]);
-    ghostMsgCountMap_[key]++;
+    ghostTargets_[ghost.pending].triggers++;
 }
 
-void CarApp::injectGhostAttack(veins::BasicSafetyMessage const* rvBsm)
+void CarApp::sendQueuedGhosts()
 {
-    using namespace vasp::attack;
-
-    auto ghostBsm = new veins::BasicSafetyMessage();
-    populateWSM(ghostBsm); // important to use this function so that receivers accept attack BSMs.
-    ghostBsm->setRecipientId(rvBsm->getAddress());
-
-    auto const mapKey{std::to_string(myId) + "-" + std::to_string(rvBsm->getAddress())};
-    setUniqueGhostAddress(mapKey, ghostBsm);
-    setGhostMsgCount(mapKey, ghostBsm);
-
-    switch (attackType_) {
-    case attack::kAttackSuddenAppearance: {
-        ghostAttack_ = std::make_unique<position::SuddenAppearance>(rvBsm);
-        break;
-    }
-    case attack::kAttackTargetedConstantPosition: {
-        ghostAttack_ = std::make_unique<position::TargetedConstantPosition>(rvBsm, posAttackOffset_, ghostPos_, targetConstPosAttackFlag_);
-        break;
-    }
-    case attack::kAttackCommRangeBraking: {
-        ghostAttack_ = std::make_unique<mobility::CommRangeBraking>(rvBsm, ghostVehicleDistance_, curSpeed);
-        break;
-    }
-    case attack::kAttackFakeEEBLJustAttack: {
-        ghostAttack_ = std::make_unique<safetyapp::eebl::JustAttack>(rvBsm);
-        break;
+    evictIdleGhosts();
+    if (ghostTargets_.empty()) {
+        return;
     }
-    case attack::kAttackFakeEEBLStopPositionUpdateAfterAttack: {
-        ghostAttack_ = std::make_unique<safetyapp::eebl::StopAfterAttack>(rvBsm);
-        break;
+
+    auto const perTargetLimit = ghostEmissionPolicy_ == attack::kGhostEmissionPerTarget ? maxGhostsPerInterval_ : INT_MAX;
+    auto budget = ghostEmissionPolicy_ == attack::kGhostEmissionTotal ? maxGhostsPerInterval_ : INT_MAX;
+    for (auto& target : ghostTargets_) {
+        target.quota = std::min(target.triggers, perTargetLimit);
+    }
+
+    // serve the targets round-robin so that a total budget is shared among them
+    auto const nTargets = ghostTargets_.size();
+    ghostTargetOffset_ = (ghostTargetOffset_ + 1) % nTargets;
+    bool sent{true};
+    while (sent and budget > 0) {
+        sent = false;
+        for (std::size_t i{0}; i < nTargets and budget > 0; ++i) {
+            auto& target = ghostTargets_[(ghostTargetOffset_ + i) % nTargets];
+            if (target.quota > 0) {
+                injectGhostAttack(target.target);
+                target.quota--;
+                budget--;
+                sent = true;
+            }
+        }
     }
-    default: {
-        delete ghostBsm;
-        ghostBsm = nullptr;
+
+    for (auto const& target : ghostTargets_) {
+        ghostsSuppressed_ += target.triggers - std::min(target.triggers, perTargetLimit) + target.quota;
+        if (auto* ghost = ghostTable_.find(GhostTable::makeKey(myId, target.target.address))) {
+            ghost->pending = -1;
+        }
     }
+    ghostTargets_.clear();
+}
+
+void CarApp::evictIdleGhosts()
+{
+    // forget targets that have left the neighbourhood
+    auto const now = simTime();
+    if (ghostIdleTimeout_ > 0 and now - lastGhostEviction_ >= ghostIdleTimeout_) {
+        ghostEvictions_ += ghostTable_.evictIdle(now, ghostIdleTimeout_);
+        lastGhostEviction_ = now;
     }
+}
 
-    if (ghostAttack_) {
-        ghostAttack_->attack(ghostBsm);
-        sendDown(ghostBsm);
+GhostTable::Entry& CarApp::getGhost(long const targetAddress)
+{
+    bool inserted{false};
+    auto& ghost = ghostTable_.findOrInsert(GhostTable::makeKey(myId, targetAddress), simTime(), inserted);
+    if (inserted) {
+        // set random, trackable and possibly unique ID for ghost
+        ghost.address = intrand(INT_MAX);
+        ghostTablePeakSize_ = std::max(ghostTablePeakSize_, static_cast<long>(ghostTable_.size()));
+    }
+    return ghost;
+}
+
+void CarApp::setGhostIdentity(long const targetAddress, veins::BasicSafetyMessage* ghostBsm)
+{
+    auto& ghost = getGhost(targetAddress);
+    ghostBsm->setAddress(ghost.address);
+
+    // track message count per remote vehicle
+    ghostBsm->setMsgCount(ghost.msgCount);
+    ghost.msgCount = (ghost.msgCount + 1) % 128; // message count should not go beyond 127
+}
+
+void CarApp::injectGhostAttack(attack::Target const& target)
+{
+    if (!ghostAttack_) {
+        return;
     }
+
+    auto ghostBsm = new veins::BasicSafetyMessage();
+    populateWSM(ghostBsm); // important to use this function so that receivers accept attack BSMs.
+    ghostBsm->setRecipientId(target.address);
+
+    setGhostIdentity(target.address, ghostBsm);
+
+    ghostAttack_->update(getBeaconContext(&target));
+    ghostAttack_->attack(ghostBsm);
+    traceManager_->logTransmission(ghostBsm);
+    sendDown(ghostBsm);
+    ghostsSent_++;
 }
 
 void CarApp::writeTrace(veins::BasicSafetyMessage const* rvBsm, simtime_t_cref rvBsmReceiveTime)
 {
-    auto hvBsm = std::make_unique<veins::BasicSafetyMessage>();
-    populateWSM(hvBsm.get());
-
-    traceManager_->logTrace(rvBsm, hvBsm.get(), rvBsmReceiveTime, eeblWarning_, imaWarning_);
+    traceManager_->logTrace(rvBsm, getHostStateBsm(), rvBsmReceiveTime, eeblWarning_, imaWarning_);
 }
 
 void CarApp::executeV2XApplications(veins::BasicSafetyMessage const* rvBsm)
 {
+    auto const& hostState = getHostState();
+
     // EEBL
     vasp::safetyapps::EEBL eebl{};
     eeblWarning_ = eebl.warning(
         rvBsm,
-        mobility->getPositionAt(simTime()),
-        mobility->getHeading(),
-        mobility->getHostSpeed(),
+        hostState.position,
+        hostState.heading,
+        hostState.speed,
         myId);
 
     // IMA
     vasp::safetyapps::IMA ima{};
-    imaWarning_ = approachingIntersection_ ? ima.warning(curPosition, curSpeed, rvBsm, junctionPos_) : false;
+    imaWarning_ = approachingIntersection_ ? ima.warning(hostState.position, hostState.speed, rvBsm, junctionPos_) : false;
+
+    // also check the junction the remote vehicle is approaching
+    if (!imaWarning_ and junctionSearchRadius_ > 0) {
+        auto const* rvJunction = junctionMap_->findNearestJunction(rvBsm->getSenderPos(), junctionSearchRadius_);
+        imaWarning_ = rvJunction != nullptr and ima.warning(hostState.position, hostState.speed, rvBsm, veins::Coord(rvJunction->x, rvJunction->y));
+    }
 }
 
 void CarApp::runIMA()
 {
-    auto currentRoad = mobility->getRoadId();
-
-    for (auto& roadObj : mapJson_["roads"]) {
-        auto road = roadObj["road"];
-        // check if approaching an intersection
-        approachingIntersection_ = road["id"] == currentRoad;
-        if (approachingIntersection_) {
-            // find junctionPos
-            auto junction = road["junction"];
-            junctionPos_ = veins::Coord(junction["x"], junction["y"]);
-        }
+    // check if approaching an intersection
+    auto const* junction = roadJunction_;
+    // roads missing from the map fall back to the nearest junction around the vehicle
+    if (junction == nullptr and junctionSearchRadius_ > 0) {
+        junction = junctionMap_->findNearestJunction(curPosition, junctionSearchRadius_);
+    }
+    approachingIntersection_ = junction != nullptr;
+    if (approachingIntersection_) {
+        junctionPos_ = veins::Coord(junction->x, junction->y);
     }
 }
 
@@ -28,20 +28,23 @@
 
 #pragma once
 
-#include <json.h>
+#include <array>
 #include <memory>
 #include <omnetpp/simtime_t.h>
 #include <string>
+#include <vector>
+#include <vasp/driver/GhostTable.h>
 #include <vasp/attack/AttackPolicy.h>
+#include <vasp/attack/GhostEmissionPolicy.h>
+#include <vasp/attack/Interface.h>
+#include <vasp/attack/Registry.h>
+#include <vasp/attack/Type.h>
+#include <vasp/messages/BasicSafetyMessage_m.h>
 #include <veins/modules/application/ieee80211p/DemoBaseApplLayer.h>
 
 // forward declarations
 
 namespace vasp {
-namespace attack {
-class Interface;
-} // namespace attack
-
 namespace logging {
 class TraceManager;
 } // namespace logging
@@ -49,18 +52,18 @@ class TraceManager;
 namespace connection {
 class Manager;
 } // namespace connection
-} // namespace vasp
 
-using json = nlohmann::json;
-
-namespace veins {
-class BasicSafetyMessage;
-} // namespace veins
+namespace map {
+class JunctionMap;
+struct Junction;
+} // namespace map
+} // namespace vasp
 
 namespace vasp {
 namespace driver {
 class CarApp final : public veins::DemoBaseApplLayer {
 public:
+    ~CarApp() override;
     void initialize(int stage) override;
     void finish() override;
 
@@ -71,45 +74,86 @@ protected:
     void populateWSM(veins::BaseFrame1609_4* wsm, veins::LAddress::L2Type rcvId = veins::LAddress::L2BROADCAST(), int serial = 0) override;
 
 private:
+    // host vehicle state as of simTime()
+    struct HostState {
+        simtime_t time{-1};
+        veins::Coord position{};
+        veins::Coord speed{};
+        veins::Heading heading{0.0};
+        double acceleration{};
+        double length{};
+        double width{};
+        double height{};
+    };
+
+    HostState const& getHostState();
+    // the host vehicle's BSM as of simTime(), for tracing
+    veins::BasicSafetyMessage const* getHostStateBsm();
+
     void writeTrace(veins::BasicSafetyMessage const* rvBsm, simtime_t_cref rvBsmReceiveTime);
     void runIMA();
     void executeV2XApplications(veins::BasicSafetyMessage const* rvBsm);
-    void injectGhostAttack(veins::BasicSafetyMessage const* bsm);
+    void injectGhostAttack(vasp::attack::Target const& target);
     void injectAttack(veins::BasicSafetyMessage* bsm);
-    void setUniqueGhostAddress(std::string const& key, veins::BasicSafetyMessage* ghostBsm);
-    void setGhostMsgCount(std::string const& key, veins::BasicSafetyMessage* ghostBsm);
+    void startFlooding();
+    void floodChannel();
+    void scheduleDosMessage(simtime_t sendTime);
+    int drawAttackType();
+    vasp::attack::BeaconContext getBeaconContext(vasp::attack::Target const* target = nullptr);
+    void queueGhostTarget(veins::BasicSafetyMessage const* rvBsm);
+    void sendQueuedGhosts();
+    void evictIdleGhosts();
+    GhostTable::Entry& getGhost(long const targetAddress);
+    void setGhostIdentity(long const targetAddress, veins::BasicSafetyMessage* ghostBsm);
 
 private:
     vasp::logging::TraceManager* traceManager_;
     veins::BaseWorldUtility* world_;
     vasp::connection::Manager* connManager_;
 
+    // host vehicle state cache, see getHostState()
+    HostState hostState_{};
+    veins::BasicSafetyMessage hostStateBsm_{};
+    simtime_t hostStateBsmTime_{-1};
+
+    // static vehicle attributes, queried from TraCI once at insertion
+    double length_{};
+    double width_{};
+    double height_{};
+    long dimensionCallsSaved_{};
+
     std::string resultDir_;
     std::string simRunID_;
     std::string bsmData_;
 
     // IMA related
-    std::shared_ptr<cMessage> runIMA_{nullptr};
+    std::string currentRoadId_{};
+    vasp::map::Junction const* roadJunction_{nullptr};
+    double junctionSearchRadius_{};
     bool approachingIntersection_{false};
     veins::Coord junctionPos_;
-    std::string mapFile_;
-    json mapJson_;
+    std::shared_ptr<vasp::map::JunctionMap const> junctionMap_{nullptr};
 
     // attack related
     int attackType_;
-    std::shared_ptr<vasp::attack::Interface> attack_{nullptr};
-    std::shared_ptr<vasp::attack::Interface> ghostAttack_{nullptr};
-    int nDosMessages_;
+    // one instance per attack type, created on first use
+    std::array<std::unique_ptr<vasp::attack::Interface>, vasp::attack::_kAttackMaxValue + 1> attackPool_{};
+    std::unique_ptr<vasp::attack::Interface> ghostAttack_{nullptr};
     vasp::attack::AttackPolicy attackPolicy_;
     double sporadicInsertionRate_;
     double maliciousProbability_;
     bool isMalicious_;
-    double posAttackOffset_{};
-    double dimensionAttackOffset_{};
-    double headingAttackOffset_{};
-    double yawRateAttackOffset_{};
-    double accelerationAttackOffset_{};
-    double speedAttackOffset_{};
+    vasp::attack::Parameters attackParameters_{};
+
+    // denial of service flooding, driven by dosEvt_ independently of the beacons
+    std::unique_ptr<vasp::attack::Interface> dosAttack_{nullptr};
+    cMessage* dosEvt_{nullptr};
+    double dosRate_{}; // flood BSMs per second during a burst
+    simtime_t dosBurstLength_{}; // 0 floods continuously
+    simtime_t dosBurstPeriod_{};
+    simtime_t dosStartTime_{};
+    simtime_t dosStopTime_{}; // negative floods until the end of the run
+    long dosMessagesSent_{};
 
     // V2X apps related
     bool eeblWarning_{};
@@ -122,12 +166,28 @@ private:
     simtime_t lastUpdate_{-1.0};
     double lastAngleRad_{-1.0};
 
+    // acceleration calculation related
+    double lastSpeed_{};
+    double curAcceleration_{};
+
     // ghost vehicle related
-    std::map<std::string, int> ghostMsgCountMap_;
-    std::map<std::string, long> ghostRvIdMap_;
-    double ghostVehicleDistance_{0.0};
-    veins::Coord ghostPos_;
-    bool targetConstPosAttackFlag_{true};
+    struct GhostTarget {
+        vasp::attack::Target target; // as of the latest BSM of this beacon interval
+        int triggers; // ghosts this target would have received under kGhostEmissionPerBsm
+        int quota; // ghosts still to send to this target in this beacon interval
+    };
+
+    vasp::attack::GhostEmissionPolicy ghostEmissionPolicy_{vasp::attack::kGhostEmissionPerBsm};
+    int maxGhostsPerInterval_{};
+    std::vector<GhostTarget> ghostTargets_{};
+    std::size_t ghostTargetOffset_{0}; // rotates which target is served first under kGhostEmissionTotal
+    long ghostsSent_{};
+    long ghostsSuppressed_{};
+    GhostTable ghostTable_{};
+    simtime_t ghostIdleTimeout_{};
+    simtime_t lastGhostEviction_{};
+    long ghostEvictions_{};
+    long ghostTablePeakSize_{};
 };
 } // namespace driver
 } // namespace vasp
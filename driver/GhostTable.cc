@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <vasp/driver/GhostTable.h>
+
+namespace vasp {
+namespace driver {
+
+namespace {
+constexpr std::size_t kInitialCapacity{16};
+} // namespace
+
+GhostTable::Entry* GhostTable::find(uint64_t const key)
+{
+    if (size_ == 0) {
+        return nullptr;
+    }
+
+    auto const mask = entries_.size() - 1;
+    for (auto slot = slotOf(key); used_[slot]; slot = (slot + 1) & mask) {
+        if (entries_[slot].key == key) {
+            return &entries_[slot];
+        }
+    }
+    return nullptr;
+}
+
+GhostTable::Entry& GhostTable::findOrInsert(uint64_t const key, omnetpp::simtime_t const& now, bool& inserted)
+{
+    if (auto* entry = find(key)) {
+        inserted = false;
+        entry->lastSeen = now;
+        return *entry;
+    }
+
+    // keep the load factor at or below one half
+    if ((size_ + 1) * 2 > entries_.size()) {
+        rehash(entries_.empty() ? kInitialCapacity : entries_.size() * 2);
+    }
+
+    auto const mask = entries_.size() - 1;
+    auto slot = slotOf(key);
+    while (used_[slot]) {
+        slot = (slot + 1) & mask;
+    }
+
+    inserted = true;
+    used_[slot] = true;
+    entries_[slot] = Entry{};
+    entries_[slot].key = key;
+    entries_[slot].lastSeen = now;
+    ++size_;
+    return entries_[slot];
+}
+
+std::size_t GhostTable::evictIdle(omnetpp::simtime_t const& now, omnetpp::simtime_t const& maxIdle)
+{
+    std::size_t evicted{0};
+    std::size_t slot{0};
+    while (slot < entries_.size()) {
+        // targets queued for the current beacon interval keep their ghost
+        if (used_[slot] and entries_[slot].pending < 0 and now - entries_[slot].lastSeen > maxIdle) {
+            // erase() may shift a later entry into this slot, so look at it again; an
+            // entry wrapped around to an already visited slot waits for the next pass
+            erase(slot);
+            ++evicted;
+            continue;
+        }
+        ++slot;
+    }
+
+    // give memory back once most targets are gone; shrinking to a load factor of
+    // at most one quarter leaves room before the next grow
+    if (entries_.size() > kInitialCapacity and size_ * 8 < entries_.size()) {
+        auto capacity = entries_.size();
+        while (capacity > kInitialCapacity and size_ * 8 < capacity) {
+            capacity /= 2;
+        }
+        rehash(capacity);
+    }
+    return evicted;
+}
+
+std::size_t GhostTable::slotOf(uint64_t const key) const
+{
+    // Fibonacci hashing spreads the mostly sequential vehicle addresses
+    auto const hash = key * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(hash >> 32) & (entries_.size() - 1);
+}
+
+void GhostTable::rehash(std::size_t const capacity)
+{
+    std::vector<Entry> oldEntries(capacity);
+    std::vector<bool> oldUsed(oldEntries.size(), false);
+    oldEntries.swap(entries_);
+    oldUsed.swap(used_);
+
+    auto const mask = entries_.size() - 1;
+    for (std::size_t i{0}; i < oldEntries.size(); ++i) {
+        if (!oldUsed[i]) {
+            continue;
+        }
+        auto slot = slotOf(oldEntries[i].key);
+        while (used_[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        used_[slot] = true;
+        entries_[slot] = oldEntries[i];
+    }
+}
+
+void GhostTable::erase(std::size_t slot)
+{
+    // backward-shift deletion: move later entries of the probe sequence into the hole
+    auto const mask = entries_.size() - 1;
+    auto next = (slot + 1) & mask;
+    while (used_[next]) {
+        auto const home = slotOf(entries_[next].key);
+        // the entry at next may move to slot only if slot lies cyclically within [home, next)
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            entries_[slot] = entries_[next];
+            slot = next;
+        }
+        next = (next + 1) & mask;
+    }
+    used_[slot] = false;
+    --size_;
+}
+
+} // namespace driver
+} // namespace vasp
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <omnetpp/simtime_t.h>
+#include <vector>
+
+namespace vasp {
+namespace driver {
+
+// Per-target bookkeeping of an attacker's ghost vehicles, keyed by the packed
+// (attacker, target) address pair. Entries live in an open-addressing hash
+// table with linear probing; removals shift the following entries back, so
+// the table never accumulates tombstones. Targets that have not been seen for
+// a while are dropped by evictIdle(), which also shrinks the table once most
+// of it is empty, so memory follows the number of live targets.
+class GhostTable final {
+public:
+    struct Entry {
+        uint64_t key{};
+        long address{};
+        int msgCount{};
+        omnetpp::simtime_t lastSeen{};
+        int pending{-1}; // index of the target's BSM queued for the current beacon interval
+    };
+
+    static uint64_t makeKey(long const attacker, long const target)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(attacker)) << 32 | static_cast<uint32_t>(target);
+    }
+
+    // entry for the given key, nullptr if missing
+    Entry* find(uint64_t const key);
+    // entry for the given key, inserted with default values if missing
+    Entry& findOrInsert(uint64_t const key, omnetpp::simtime_t const& now, bool& inserted);
+    // drop all entries not seen for longer than maxIdle and not pending, returns the number of dropped entries;
+    // invalidates references to the remaining entries
+    std::size_t evictIdle(omnetpp::simtime_t const& now, omnetpp::simtime_t const& maxIdle);
+
+    std::size_t size() const { return size_; }
+
+private:
+    std::size_t slotOf(uint64_t const key) const;
+    void rehash(std::size_t const capacity);
+    void erase(std::size_t slot);
+
+private:
+    std::vector<Entry> entries_{};
+    std::vector<bool> used_{};
+    std::size_t size_{0};
+};
+
+} // namespace driver
+} // namespace vasp
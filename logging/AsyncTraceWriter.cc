@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <chrono>
+#include <vasp/logging/AsyncTraceWriter.h>
+#include <vasp/logging/TraceSink.h>
+
+namespace vasp {
+namespace logging {
+
+namespace {
+auto constexpr kIdleWait = std::chrono::microseconds(200);
+} // namespace
+
+AsyncTraceWriter::AsyncTraceWriter(TraceSink& sink, std::size_t const queueSize)
+    : sink_(sink)
+    , queue_(queueSize)
+{
+}
+
+AsyncTraceWriter::~AsyncTraceWriter()
+{
+    if (thread_.joinable()) {
+        stopRequested_ = true;
+        thread_.join();
+    }
+}
+
+void AsyncTraceWriter::start()
+{
+    stopRequested_ = false;
+    thread_ = std::thread(&AsyncTraceWriter::run, this);
+}
+
+void AsyncTraceWriter::push(TraceRecord const& record)
+{
+    rethrowWriterError();
+    if (queue_.tryPush(record)) {
+        return;
+    }
+
+    // back-pressure: wait for the writer thread to make room
+    ++queueFullCount_;
+    while (!queue_.tryPush(record)) {
+        rethrowWriterError();
+        std::this_thread::yield();
+    }
+}
+
+void AsyncTraceWriter::requestFlush()
+{
+    flushRequested_.store(true, std::memory_order_relaxed);
+}
+
+void AsyncTraceWriter::stop()
+{
+    if (thread_.joinable()) {
+        stopRequested_ = true;
+        thread_.join();
+    }
+    rethrowWriterError();
+}
+
+uint64_t AsyncTraceWriter::getQueueFullCount() const
+{
+    return queueFullCount_;
+}
+
+void AsyncTraceWriter::run()
+{
+    try {
+        TraceRecord record{};
+        while (true) {
+            // check before draining so that everything pushed before stop() is written
+            bool const stopping{stopRequested_.load(std::memory_order_acquire)};
+
+            bool wrote{false};
+            while (queue_.tryPop(record)) {
+                sink_.write(record);
+                wrote = true;
+            }
+
+            if (flushRequested_.exchange(false, std::memory_order_relaxed)) {
+                sink_.flush();
+            }
+            if (stopping) {
+                break;
+            }
+            if (!wrote) {
+                std::this_thread::sleep_for(kIdleWait);
+            }
+        }
+    }
+    catch (...) {
+        error_ = std::current_exception();
+        failed_.store(true, std::memory_order_release);
+    }
+}
+
+void AsyncTraceWriter::rethrowWriterError()
+{
+    if (failed_.load(std::memory_order_acquire)) {
+        auto error = error_;
+        error_ = nullptr;
+        failed_.store(false, std::memory_order_relaxed);
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace logging
+} // namespace vasp
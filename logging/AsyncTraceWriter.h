@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vasp/logging/SpscRingBuffer.h>
+#include <vasp/logging/TraceRecord.h>
+
+namespace vasp {
+namespace logging {
+class TraceSink;
+
+// Formats and writes trace records on a background thread so that the
+// simulation thread only copies fixed-size records into a lock-free queue.
+// push() blocks while the queue is full (back-pressure); stop() drains the
+// queue and joins the thread. The sink must not be used by anyone else
+// between start() and stop().
+class AsyncTraceWriter final {
+public:
+    AsyncTraceWriter(TraceSink& sink, std::size_t const queueSize);
+    ~AsyncTraceWriter();
+
+    AsyncTraceWriter(AsyncTraceWriter const&) = delete;
+    AsyncTraceWriter& operator=(AsyncTraceWriter const&) = delete;
+
+    void start();
+    void push(TraceRecord const& record);
+    void requestFlush();
+    void stop();
+
+    uint64_t getQueueFullCount() const;
+
+private:
+    void run();
+    void rethrowWriterError();
+
+private:
+    TraceSink& sink_;
+    SpscRingBuffer<TraceRecord> queue_;
+    std::thread thread_{};
+    std::atomic<bool> stopRequested_{false};
+    std::atomic<bool> flushRequested_{false};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_{nullptr};
+    uint64_t queueFullCount_{0};
+};
+
+} // namespace logging
+} // namespace vasp
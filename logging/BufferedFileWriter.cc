@@ -0,0 +1,148 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <omnetpp/cexception.h>
+#include <vasp/logging/BufferedFileWriter.h>
+
+namespace vasp {
+namespace logging {
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+    if (file_ == nullptr) {
+        return;
+    }
+
+    // best effort, errors can't be reported from here
+    try {
+        flush();
+    }
+    catch (omnetpp::cRuntimeError const&) {
+    }
+    std::fclose(file_);
+}
+
+void BufferedFileWriter::open(std::string const& filepath, std::size_t const bufferSize, std::unique_ptr<TraceCompressor> compressor)
+{
+    close();
+
+    filepath_ = filepath;
+    file_ = std::fopen(filepath_.c_str(), "wb");
+    if (file_ == nullptr) {
+        throw omnetpp::cRuntimeError("Unable to open trace file: \"%s\"", filepath_.c_str());
+    }
+
+    // all buffering happens in buffer_
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+    buffer_.resize(std::max<std::size_t>(bufferSize, 1));
+    used_ = 0;
+    compressor_ = std::move(compressor);
+}
+
+void BufferedFileWriter::write(char const* data, std::size_t size)
+{
+    while (size > 0) {
+        if (used_ == buffer_.size()) {
+            flush();
+        }
+        auto const chunk = std::min(size, buffer_.size() - used_);
+        std::memcpy(buffer_.data() + used_, data, chunk);
+        used_ += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+void BufferedFileWriter::write(std::string const& data)
+{
+    write(data.data(), data.size());
+}
+
+void BufferedFileWriter::flush()
+{
+    if (file_ == nullptr or used_ == 0) {
+        return;
+    }
+
+    auto const* data = buffer_.data();
+    auto size = used_;
+    if (compressor_) {
+        compressor_->compress(data, size, compressed_);
+        data = compressed_.data();
+        size = compressed_.size();
+    }
+
+    if (std::fwrite(data, 1, size, file_) != size) {
+        throw omnetpp::cRuntimeError("Unable to write trace file: \"%s\"", filepath_.c_str());
+    }
+    bytesWritten_ += size;
+    uncompressedBytesWritten_ += used_;
+    ++flushCount_;
+    used_ = 0;
+}
+
+void BufferedFileWriter::close()
+{
+    if (file_ == nullptr) {
+        return;
+    }
+
+    flush();
+    std::fclose(file_);
+    file_ = nullptr;
+}
+
+bool BufferedFileWriter::isOpen() const
+{
+    return file_ != nullptr;
+}
+
+std::size_t BufferedFileWriter::getBufferedSize() const
+{
+    return used_;
+}
+
+uint64_t BufferedFileWriter::getFlushCount() const
+{
+    return flushCount_;
+}
+
+uint64_t BufferedFileWriter::getBytesWritten() const
+{
+    return bytesWritten_;
+}
+
+uint64_t BufferedFileWriter::getUncompressedBytesWritten() const
+{
+    return uncompressedBytesWritten_;
+}
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <vasp/logging/TraceCompressor.h>
+
+namespace vasp {
+namespace logging {
+
+// Append-only file kept open for its whole lifetime. Writes are collected in a
+// user-space buffer and handed to the OS in one write once the buffer is full
+// or flush() is called. With a compressor every such write is one compressed
+// chunk.
+class BufferedFileWriter final {
+public:
+    BufferedFileWriter() = default;
+    ~BufferedFileWriter();
+
+    BufferedFileWriter(BufferedFileWriter const&) = delete;
+    BufferedFileWriter& operator=(BufferedFileWriter const&) = delete;
+
+    void open(std::string const& filepath, std::size_t const bufferSize, std::unique_ptr<TraceCompressor> compressor = nullptr);
+    void write(char const* data, std::size_t const size);
+    void write(std::string const& data);
+    void flush();
+    void close();
+
+    bool isOpen() const;
+    std::size_t getBufferedSize() const;
+    uint64_t getFlushCount() const;
+    uint64_t getBytesWritten() const;
+    uint64_t getUncompressedBytesWritten() const;
+
+private:
+    std::string filepath_{};
+    std::FILE* file_{nullptr};
+    std::vector<char> buffer_{};
+    std::size_t used_{0};
+    std::unique_ptr<TraceCompressor> compressor_{nullptr};
+    std::vector<char> compressed_{};
+    uint64_t flushCount_{0};
+    uint64_t bytesWritten_{0};
+    uint64_t uncompressedBytesWritten_{0};
+};
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vasp/logging/BufferedFileWriter.h>
+#include <vasp/logging/ColumnarTraceSink.h>
+
+namespace vasp {
+namespace logging {
+
+namespace {
+char constexpr kTraceMagic[8]{'V', 'A', 'S', 'P', 'T', 'R', 'C', 'B'};
+uint32_t constexpr kTraceVersion{1};
+char constexpr kDictionaryBlock{'D'};
+char constexpr kRowGroupBlock{'R'};
+} // namespace
+
+template <typename T>
+void ColumnarTraceSink::append(std::vector<char>& column, T const value)
+{
+    auto const* bytes = reinterpret_cast<char const*>(&value);
+    column.insert(column.end(), bytes, bytes + sizeof(T));
+}
+
+ColumnarTraceSink::ColumnarTraceSink(BufferedFileWriter& writer, std::size_t const rowGroupSize, TraceColumnPlan plan)
+    : writer_(writer)
+    , rowGroupSize_(std::max<std::size_t>(rowGroupSize, 1))
+    , plan_(std::move(plan))
+    , columns_(plan_.size())
+{
+}
+
+void ColumnarTraceSink::writeHeader()
+{
+    std::vector<char> header(kTraceMagic, kTraceMagic + sizeof(kTraceMagic));
+    append(header, kTraceVersion);
+    append(header, static_cast<int32_t>(omnetpp::SimTime::getScaleExp()));
+    append(header, static_cast<uint32_t>(plan_.size()));
+    for (auto const index : plan_) {
+        auto const& column = kTraceColumns[index];
+        auto const nameLength = static_cast<uint8_t>(std::strlen(column.name));
+        append(header, static_cast<uint8_t>(column.type));
+        append(header, nameLength);
+        header.insert(header.end(), column.name, column.name + nameLength);
+    }
+    writer_.write(header.data(), header.size());
+}
+
+void ColumnarTraceSink::write(TraceRecord const& record)
+{
+    auto const* base = reinterpret_cast<char const*>(&record);
+    for (std::size_t i = 0; i < plan_.size(); ++i) {
+        auto const& column = kTraceColumns[plan_[i]];
+        auto const* field = base + column.offset;
+        switch (column.type) {
+        case kTraceColumnInt64:
+            append(columns_[i], static_cast<int64_t>(*reinterpret_cast<long const*>(field)));
+            break;
+        case kTraceColumnInt32:
+            append(columns_[i], static_cast<int32_t>(*reinterpret_cast<int const*>(field)));
+            break;
+        case kTraceColumnFloat64:
+            append(columns_[i], *reinterpret_cast<double const*>(field));
+            break;
+        case kTraceColumnSimTime:
+            append(columns_[i], static_cast<int64_t>(reinterpret_cast<omnetpp::SimTime const*>(field)->raw()));
+            break;
+        case kTraceColumnString:
+            append(columns_[i], getStringCode(field));
+            break;
+        case kTraceColumnBool:
+            append(columns_[i], static_cast<uint8_t>(*reinterpret_cast<bool const*>(field)));
+            break;
+        }
+    }
+
+    if (++rowCount_ == rowGroupSize_) {
+        writeRowGroup();
+    }
+}
+
+void ColumnarTraceSink::flush()
+{
+    writeRowGroup();
+    writer_.flush();
+}
+
+uint32_t ColumnarTraceSink::getStringCode(char const* str)
+{
+    auto const it = dictionary_.find(str);
+    if (it != dictionary_.end()) {
+        return it->second;
+    }
+
+    auto const code = static_cast<uint32_t>(dictionary_.size());
+    dictionary_.emplace(str, code);
+    newDictionaryEntries_.emplace_back(str);
+    return code;
+}
+
+void ColumnarTraceSink::writeRowGroup()
+{
+    if (rowCount_ == 0) {
+        return;
+    }
+
+    // dictionary entries have to precede the first row group using them
+    if (!newDictionaryEntries_.empty()) {
+        std::vector<char> block{kDictionaryBlock};
+        append(block, static_cast<uint32_t>(newDictionaryEntries_.size()));
+        for (auto const& entry : newDictionaryEntries_) {
+            append(block, static_cast<uint32_t>(entry.size()));
+            block.insert(block.end(), entry.begin(), entry.end());
+        }
+        writer_.write(block.data(), block.size());
+        newDictionaryEntries_.clear();
+    }
+
+    std::vector<char> blockHeader{kRowGroupBlock};
+    append(blockHeader, rowCount_);
+    writer_.write(blockHeader.data(), blockHeader.size());
+    for (auto& column : columns_) {
+        writer_.write(column.data(), column.size());
+        column.clear();
+    }
+    rowCount_ = 0;
+}
+
+} // namespace logging
+} // namespace vasp
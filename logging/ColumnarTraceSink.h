@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <vasp/logging/TraceRecord.h>
+#include <vasp/logging/TraceSink.h>
+
+namespace vasp {
+namespace logging {
+class BufferedFileWriter;
+
+// rx trace as typed, fixed-width columns stored in row groups:
+//
+//   char magic[8] = "VASPTRCB"; uint32_t version; int32_t simtimeScaleExponent; uint32_t columnCount
+//   columnCount x { uint8_t type (TraceColumnType); uint8_t nameLength; char name[nameLength] }
+//   blocks until the end of the file:
+//     'D' uint32_t entryCount, entryCount x { uint32_t length; char text[length] }
+//         appends entries to the string dictionary; string columns hold uint32_t dictionary codes
+//     'R' uint32_t rowCount, then for every column rowCount values of its width:
+//         int64 (8), int32 (4), float64 (8), SimTime raw ticks as int64 (8), string code (4), bool (1)
+//
+// All values are little-endian. tools/trace_to_csv.py reads this format.
+class ColumnarTraceSink final : public TraceSink {
+public:
+    ColumnarTraceSink(BufferedFileWriter& writer, std::size_t const rowGroupSize, TraceColumnPlan plan);
+
+    void writeHeader() override;
+    void write(TraceRecord const& record) override;
+    void flush() override;
+
+private:
+    uint32_t getStringCode(char const* str);
+    void writeRowGroup();
+
+    template <typename T>
+    static void append(std::vector<char>& column, T const value);
+
+private:
+    BufferedFileWriter& writer_;
+    std::size_t const rowGroupSize_;
+    TraceColumnPlan const plan_;
+    uint32_t rowCount_{0};
+    std::vector<std::vector<char>> columns_{};
+
+    std::unordered_map<std::string, uint32_t> dictionary_{};
+    std::vector<std::string> newDictionaryEntries_{};
+};
+
+} // namespace logging
+} // namespace vasp
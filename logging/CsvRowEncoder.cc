@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <omnetpp/simtime.h>
+#include <utility>
+#include <vasp/logging/CsvRowEncoder.h>
+#include <vasp/logging/DoubleToChars.h>
+
+namespace vasp {
+namespace logging {
+
+namespace {
+// "-" + 17 digits + "." + "e-308"
+int constexpr kMaxDoubleSize{25};
+
+char* writeUnsigned(char* out, uint64_t value)
+{
+    char digits[20];
+    auto count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+char* writeInteger(char* out, int64_t const value)
+{
+    if (value < 0) {
+        *out++ = '-';
+        // negate in unsigned arithmetic so that INT64_MIN works too
+        return writeUnsigned(out, 0 - static_cast<uint64_t>(value));
+    }
+    return writeUnsigned(out, static_cast<uint64_t>(value));
+}
+
+char* writeDouble(char* out, double const value)
+{
+    if (!std::isfinite(value)) {
+        return out + std::sprintf(out, "%g", value);
+    }
+
+    // whole numbers (dimensions, ids, zeroed fields, ...) without the ".0"
+    if (std::abs(value) < 1e15 and value == std::trunc(value)) {
+        if (std::signbit(value)) {
+            *out++ = '-';
+        }
+        return writeUnsigned(out, static_cast<uint64_t>(std::abs(value)));
+    }
+
+    // shortest round-trip digits (Grisu2), see DoubleToChars.h
+    return detail::to_chars(out, out + kMaxDoubleSize, value);
+}
+
+char* writeSimTime(char* out, omnetpp::SimTime const& value)
+{
+    auto const ticks = value.raw();
+    auto scale = uint64_t{1};
+    for (auto i = omnetpp::SimTime::getScaleExp(); i < 0; ++i) {
+        scale *= 10;
+    }
+
+    if (ticks < 0) {
+        *out++ = '-';
+    }
+    auto const magnitude = ticks < 0 ? 0 - static_cast<uint64_t>(ticks) : static_cast<uint64_t>(ticks);
+    out = writeUnsigned(out, magnitude / scale);
+
+    auto fraction = magnitude % scale;
+    if (fraction == 0) {
+        return out;
+    }
+    *out++ = '.';
+    for (scale /= 10; fraction != 0; scale /= 10) {
+        *out++ = static_cast<char>('0' + fraction / scale);
+        fraction %= scale;
+    }
+    return out;
+}
+
+char* writeString(char* out, char const* value)
+{
+    // same quoting as CSVWriter: quote if the value has a comma or a quote,
+    // and double the quotes inside
+    auto const length = std::strlen(value);
+    if (std::strpbrk(value, ",\"") == nullptr) {
+        std::memcpy(out, value, length);
+        return out + length;
+    }
+
+    *out++ = '"';
+    for (auto const* c = value; *c != '\0'; ++c) {
+        if (*c == '"') {
+            *out++ = '"';
+        }
+        *out++ = *c;
+    }
+    *out++ = '"';
+    return out;
+}
+} // namespace
+
+CsvRowEncoder::CsvRowEncoder(TraceColumnPlan plan)
+    : plan_(std::move(plan))
+{
+}
+
+void CsvRowEncoder::encodeHeader()
+{
+    auto* out = row_;
+    for (std::size_t i = 0; i < plan_.size(); ++i) {
+        if (i > 0) {
+            *out++ = ',';
+        }
+        out = writeString(out, kTraceColumns[plan_[i]].name);
+    }
+    *out++ = '\n';
+    size_ = static_cast<std::size_t>(out - row_);
+}
+
+void CsvRowEncoder::encode(TraceRecord const& record)
+{
+    auto const* base = reinterpret_cast<char const*>(&record);
+    auto* out = row_;
+    for (std::size_t i = 0; i < plan_.size(); ++i) {
+        if (i > 0) {
+            *out++ = ',';
+        }
+
+        auto const& column = kTraceColumns[plan_[i]];
+        auto const* field = base + column.offset;
+        switch (column.type) {
+        case kTraceColumnInt64:
+            out = writeInteger(out, *reinterpret_cast<long const*>(field));
+            break;
+        case kTraceColumnInt32:
+            out = writeInteger(out, *reinterpret_cast<int const*>(field));
+            break;
+        case kTraceColumnFloat64:
+            out = writeDouble(out, *reinterpret_cast<double const*>(field));
+            break;
+        case kTraceColumnSimTime:
+            out = writeSimTime(out, *reinterpret_cast<omnetpp::SimTime const*>(field));
+            break;
+        case kTraceColumnString:
+            out = writeString(out, field);
+            break;
+        case kTraceColumnBool:
+            *out++ = *reinterpret_cast<bool const*>(field) ? '1' : '0';
+            break;
+        }
+    }
+    *out++ = '\n';
+    size_ = static_cast<std::size_t>(out - row_);
+}
+
+char const* CsvRowEncoder::getData() const
+{
+    return row_;
+}
+
+std::size_t CsvRowEncoder::getSize() const
+{
+    return size_;
+}
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vasp/logging/TraceRecord.h>
+
+namespace vasp {
+namespace logging {
+
+// Encodes trace rows as CSV lines into a fixed buffer that is reused for
+// every row, without iostreams or heap allocations. Integers and SimTimes are
+// printed exactly, doubles with the shortest digits that parse back to the
+// same value. Strings are quoted the way CSVWriter quotes them.
+class CsvRowEncoder final {
+public:
+    // every column fits even as a fully escaped string plus its separator
+    static std::size_t constexpr kMaxRowSize{kTraceColumnCount * (2 * kTraceStringSize + 2) + 1};
+
+    explicit CsvRowEncoder(TraceColumnPlan plan);
+
+    void encodeHeader();
+    void encode(TraceRecord const& record);
+
+    // the last encoded line including its '\n', valid until the next encode
+    char const* getData() const;
+    std::size_t getSize() const;
+
+private:
+    TraceColumnPlan const plan_;
+    char row_[kMaxRowSize];
+    std::size_t size_{0};
+};
+
+} // namespace logging
+} // namespace vasp
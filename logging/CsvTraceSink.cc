@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <vasp/logging/BufferedFileWriter.h>
+#include <utility>
+#include <vasp/logging/CsvTraceSink.h>
+
+namespace vasp {
+namespace logging {
+
+CsvTraceSink::CsvTraceSink(BufferedFileWriter& writer, TraceColumnPlan plan)
+    : writer_(writer)
+    , encoder_(std::move(plan))
+{
+}
+
+void CsvTraceSink::writeHeader()
+{
+    encoder_.encodeHeader();
+    writer_.write(encoder_.getData(), encoder_.getSize());
+}
+
+void CsvTraceSink::write(TraceRecord const& record)
+{
+    encoder_.encode(record);
+    writer_.write(encoder_.getData(), encoder_.getSize());
+}
+
+void CsvTraceSink::flush()
+{
+    writer_.flush();
+}
+
+} // namespace logging
+} // namespace vasp
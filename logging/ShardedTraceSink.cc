@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <CSVWriter.h>
+#include <algorithm>
+#include <cstdio>
+#include <omnetpp/cexception.h>
+#include <vasp/logging/ShardedTraceSink.h>
+#include <vasp/logging/TraceCompressor.h>
+#include <vasp/logging/TraceRecord.h>
+
+namespace vasp {
+namespace logging {
+
+namespace {
+// segments are listed as soon as they are finished, the manifest stays small
+std::size_t constexpr kManifestBufferSize{4096};
+char const* const kManifestColumns[]{
+    "file", "partition", "segment", "rows",
+    "first_rcv_time", "last_rcv_time",
+    "min_hv_id", "max_hv_id", "min_rv_id", "max_rv_id"};
+} // namespace
+
+bool ShardingPolicy::isSharded() const
+{
+    return partitions > 1 or maxSegmentBytes > 0 or maxSegmentRows > 0 or segmentTimeWindow > 0;
+}
+
+int getTracePartition(long const hvId, int const partitions)
+{
+    auto x = static_cast<uint64_t>(hvId);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return static_cast<int>(x % static_cast<uint64_t>(partitions));
+}
+
+ShardedTraceSink::ShardedTraceSink(std::string const& filepath, std::string const& suffix, ShardingPolicy const& policy, SinkFactory createSink)
+    : policy_(policy)
+    , createSink_(std::move(createSink))
+    , partitions_(static_cast<std::size_t>(std::max(policy.partitions, 1)))
+{
+    // "dir/rxtrace-0.csv.gz" -> "dir/rxtrace-0<suffix>" and ".csv.gz"
+    auto const nameStart = filepath.find_last_of('/') + 1;
+    auto const extension = std::min(filepath.find('.', nameStart), filepath.size());
+    stem_ = filepath.substr(0, extension) + suffix;
+    extension_ = filepath.substr(extension);
+
+    if (!policy_.isSharded()) {
+        return;
+    }
+
+    manifest_.open(stem_ + ".manifest.csv", kManifestBufferSize);
+    CSVWriter csv{","};
+    for (auto const* column : kManifestColumns) {
+        csv << column;
+    }
+    manifest_.write(csv.toString());
+    manifest_.write("\n", 1);
+    manifest_.flush();
+}
+
+void ShardedTraceSink::writeHeader()
+{
+    // segment files get their header when they are opened; an unsharded
+    // trace is opened right away so that it exists even without rows
+    if (!policy_.isSharded()) {
+        openSegment(0, partitions_.front(), 0);
+    }
+}
+
+void ShardedTraceSink::write(TraceRecord const& record)
+{
+    auto const index = getTracePartition(record.hvId, static_cast<int>(partitions_.size()));
+    auto& partition = partitions_[index];
+    auto const timeWindow = policy_.segmentTimeWindow > 0 ? record.msgReceiveTime.raw() / policy_.segmentTimeWindow.raw() : 0;
+
+    if (partition.sink and isSegmentFull(partition, timeWindow)) {
+        closeSegment(index, partition);
+    }
+    if (!partition.sink) {
+        openSegment(index, partition, timeWindow);
+    }
+
+    partition.sink->write(record);
+
+    auto& segment = partition.segment;
+    if (segment.rows == 0) {
+        segment.firstReceiveTime = record.msgReceiveTime;
+        segment.minHvId = segment.maxHvId = record.hvId;
+        segment.minRvId = segment.maxRvId = record.rvId;
+    }
+    ++segment.rows;
+    segment.firstReceiveTime = std::min(segment.firstReceiveTime, record.msgReceiveTime);
+    segment.lastReceiveTime = std::max(segment.lastReceiveTime, record.msgReceiveTime);
+    segment.minHvId = std::min(segment.minHvId, record.hvId);
+    segment.maxHvId = std::max(segment.maxHvId, record.hvId);
+    segment.minRvId = std::min(segment.minRvId, record.rvId);
+    segment.maxRvId = std::max(segment.maxRvId, record.rvId);
+}
+
+void ShardedTraceSink::flush()
+{
+    for (auto& partition : partitions_) {
+        if (partition.sink) {
+            partition.sink->flush();
+        }
+    }
+}
+
+void ShardedTraceSink::close()
+{
+    for (std::size_t i = 0; i < partitions_.size(); ++i) {
+        if (partitions_[i].sink) {
+            closeSegment(static_cast<int>(i), partitions_[i]);
+        }
+    }
+    manifest_.close();
+}
+
+bool ShardedTraceSink::isSegmentFull(Partition const& partition, int64_t const timeWindow) const
+{
+    if (policy_.maxSegmentRows > 0 and partition.segment.rows >= policy_.maxSegmentRows) {
+        return true;
+    }
+    if (policy_.maxSegmentBytes > 0 and partition.writer.getUncompressedBytesWritten() + partition.writer.getBufferedSize() - partition.segmentStartBytes >= policy_.maxSegmentBytes) {
+        return true;
+    }
+    return timeWindow != partition.timeWindow;
+}
+
+void ShardedTraceSink::openSegment(int const index, Partition& partition, int64_t const timeWindow)
+{
+    partition.segment = Segment{};
+    partition.segment.filepath = getSegmentPath(index, partition.segmentCount);
+    partition.timeWindow = timeWindow;
+    partition.writer.open(partition.segment.filepath, policy_.bufferSize, TraceCompressor::create(policy_.compression, policy_.compressionLevel));
+    partition.segmentStartBytes = partition.writer.getUncompressedBytesWritten();
+    partition.sink = createSink_(partition.writer);
+    partition.sink->writeHeader();
+}
+
+void ShardedTraceSink::closeSegment(int const index, Partition& partition)
+{
+    partition.sink->flush();
+    partition.sink.reset();
+    partition.writer.close();
+
+    ++segmentCount_;
+    ++partition.segmentCount;
+    if (!manifest_.isOpen()) {
+        return;
+    }
+
+    auto const& segment = partition.segment;
+    CSVWriter csv{","};
+    csv << segment.filepath.substr(segment.filepath.find_last_of('/') + 1)
+        << index
+        << partition.segmentCount - 1
+        << segment.rows
+        << segment.firstReceiveTime
+        << segment.lastReceiveTime
+        << segment.minHvId
+        << segment.maxHvId
+        << segment.minRvId
+        << segment.maxRvId;
+    manifest_.write(csv.toString());
+    manifest_.write("\n", 1);
+    manifest_.flush();
+}
+
+std::string ShardedTraceSink::getSegmentPath(int const partition, uint64_t const segment) const
+{
+    if (!policy_.isSharded()) {
+        return stem_ + extension_;
+    }
+
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".p%02d.s%04llu", partition, static_cast<unsigned long long>(segment));
+    return stem_ + suffix + extension_;
+}
+
+uint64_t ShardedTraceSink::getSegmentCount() const
+{
+    return segmentCount_;
+}
+
+uint64_t ShardedTraceSink::getFlushCount() const
+{
+    uint64_t count{0};
+    for (auto const& partition : partitions_) {
+        count += partition.writer.getFlushCount();
+    }
+    return count;
+}
+
+uint64_t ShardedTraceSink::getBytesWritten() const
+{
+    uint64_t bytes{0};
+    for (auto const& partition : partitions_) {
+        bytes += partition.writer.getBytesWritten();
+    }
+    return bytes;
+}
+
+uint64_t ShardedTraceSink::getUncompressedBytesWritten() const
+{
+    uint64_t bytes{0};
+    for (auto const& partition : partitions_) {
+        bytes += partition.writer.getUncompressedBytesWritten();
+    }
+    return bytes;
+}
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <omnetpp/simtime.h>
+#include <string>
+#include <vector>
+#include <vasp/logging/BufferedFileWriter.h>
+#include <vasp/logging/TraceSink.h>
+
+namespace vasp {
+namespace logging {
+
+struct ShardingPolicy {
+    // records go to partition getTracePartition(hvId, partitions)
+    int partitions{1};
+    // a partition starts a new segment once any enabled (non-zero) limit is hit
+    uint64_t maxSegmentBytes{0}; // uncompressed
+    uint64_t maxSegmentRows{0};
+    omnetpp::SimTime segmentTimeWindow{}; // segments cover [k * window, (k + 1) * window)
+
+    std::size_t bufferSize{0};
+    std::string compression{"none"};
+    int compressionLevel{-1};
+
+    bool isSharded() const;
+};
+
+// Splits the trace "<name><ext>" into segment files
+// "<name><suffix>.p<partition>.s<segment><ext>", where <ext> starts at the first
+// dot of the file name. Every finished segment is appended to the manifest
+// "<name><suffix>.manifest.csv" with its row count and its receive time and id
+// ranges. A policy that doesn't shard writes "<name><suffix><ext>" only.
+class ShardedTraceSink final : public TraceSink {
+public:
+    using SinkFactory = std::function<std::unique_ptr<TraceSink>(BufferedFileWriter&)>;
+
+    ShardedTraceSink(std::string const& filepath, std::string const& suffix, ShardingPolicy const& policy, SinkFactory createSink);
+
+    void writeHeader() override;
+    void write(TraceRecord const& record) override;
+    void flush() override;
+    // finishes all open segments and the manifest
+    void close();
+
+    uint64_t getSegmentCount() const;
+    uint64_t getFlushCount() const;
+    uint64_t getBytesWritten() const;
+    uint64_t getUncompressedBytesWritten() const;
+
+private:
+    struct Segment {
+        std::string filepath{};
+        uint64_t rows{0};
+        omnetpp::SimTime firstReceiveTime{};
+        omnetpp::SimTime lastReceiveTime{};
+        long minHvId{0};
+        long maxHvId{0};
+        long minRvId{0};
+        long maxRvId{0};
+    };
+
+    struct Partition {
+        BufferedFileWriter writer{};
+        std::unique_ptr<TraceSink> sink{nullptr};
+        Segment segment{};
+        uint64_t segmentCount{0};
+        uint64_t segmentStartBytes{0}; // writer counters span all segments of the partition
+        int64_t timeWindow{0};
+    };
+
+    bool isSegmentFull(Partition const& partition, int64_t const timeWindow) const;
+    void openSegment(int const index, Partition& partition, int64_t const timeWindow);
+    void closeSegment(int const index, Partition& partition);
+    std::string getSegmentPath(int const partition, uint64_t const segment) const;
+
+private:
+    std::string stem_{};
+    std::string extension_{};
+    ShardingPolicy const policy_;
+    SinkFactory const createSink_;
+    std::vector<Partition> partitions_;
+    BufferedFileWriter manifest_{};
+
+    uint64_t segmentCount_{0};
+};
+
+// partition of a host vehicle: splitmix64 finalizer of hvId modulo partitions
+int getTracePartition(long const hvId, int const partitions);
+
+
+} // namespace logging
+} // namespace vasp
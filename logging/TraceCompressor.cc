@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <omnetpp/cexception.h>
+#include <vasp/logging/TraceCompressor.h>
+#include <zlib.h>
+#ifdef VASP_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+namespace vasp {
+namespace logging {
+
+namespace {
+class GzipCompressor final : public TraceCompressor {
+public:
+    explicit GzipCompressor(int const level)
+    {
+        // windowBits + 16 writes a gzip instead of a zlib wrapper
+        if (deflateInit2(&stream_, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw omnetpp::cRuntimeError("Invalid gzip compression level: %d", level);
+        }
+    }
+
+    ~GzipCompressor() override
+    {
+        deflateEnd(&stream_);
+    }
+
+    void compress(char const* data, std::size_t const size, std::vector<char>& out) override
+    {
+        out.resize(deflateBound(&stream_, static_cast<uLong>(size)));
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        stream_.avail_in = static_cast<uInt>(size);
+        stream_.next_out = reinterpret_cast<Bytef*>(out.data());
+        stream_.avail_out = static_cast<uInt>(out.size());
+
+        // Z_FINISH closes the member so every chunk ends with a complete trailer
+        if (deflate(&stream_, Z_FINISH) != Z_STREAM_END) {
+            throw omnetpp::cRuntimeError("Unable to gzip trace chunk");
+        }
+        out.resize(out.size() - stream_.avail_out);
+        deflateReset(&stream_);
+    }
+
+private:
+    z_stream stream_{};
+};
+
+#ifdef VASP_WITH_ZSTD
+class ZstdCompressor final : public TraceCompressor {
+public:
+    explicit ZstdCompressor(int const level)
+        : context_(ZSTD_createCCtx())
+        , level_(level == -1 ? ZSTD_CLEVEL_DEFAULT : level)
+    {
+        if (context_ == nullptr) {
+            throw omnetpp::cRuntimeError("Unable to create zstd context");
+        }
+    }
+
+    ~ZstdCompressor() override
+    {
+        ZSTD_freeCCtx(context_);
+    }
+
+    void compress(char const* data, std::size_t const size, std::vector<char>& out) override
+    {
+        out.resize(ZSTD_compressBound(size));
+        auto const written = ZSTD_compressCCtx(context_, out.data(), out.size(), data, size, level_);
+        if (ZSTD_isError(written)) {
+            throw omnetpp::cRuntimeError("Unable to zstd trace chunk: %s", ZSTD_getErrorName(written));
+        }
+        out.resize(written);
+    }
+
+private:
+    ZSTD_CCtx* context_;
+    int const level_;
+};
+#endif
+} // namespace
+
+std::unique_ptr<TraceCompressor> TraceCompressor::create(std::string const& codec, int const level)
+{
+    if (codec == "none") {
+        return nullptr;
+    }
+    if (codec == "gzip") {
+        return std::unique_ptr<TraceCompressor>(new GzipCompressor(level));
+    }
+    if (codec == "zstd") {
+#ifdef VASP_WITH_ZSTD
+        return std::unique_ptr<TraceCompressor>(new ZstdCompressor(level));
+#else
+        throw omnetpp::cRuntimeError("Trace compression \"zstd\" requires building with VASP_WITH_ZSTD");
+#endif
+    }
+    throw omnetpp::cRuntimeError("Unknown trace compression: \"%s\"", codec.c_str());
+}
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <cmath>
+#include <vasp/attack/Type.h>
+#include <vasp/logging/TraceFilter.h>
+#include <vasp/messages/BasicSafetyMessage_m.h>
+
+namespace vasp {
+namespace logging {
+
+TraceFilter::TraceFilter(TraceFilterRules rules)
+    : rules_(std::move(rules))
+{
+    enabled_ = rules_.attacksOnly or rules_.eeblWarnings or rules_.imaWarnings
+        or !rules_.hvIds.empty() or !rules_.rvIds.empty()
+        or rules_.startTime > 0 or rules_.endTime >= 0
+        or rules_.hasArea or rules_.samplingRate < 1.0;
+}
+
+bool TraceFilter::accepts(
+    veins::BasicSafetyMessage const* rvBsm,
+    veins::BasicSafetyMessage const* hvBsm,
+    omnetpp::SimTime const& bsmReceiveTime,
+    bool const eeblWarning,
+    bool const imaWarning)
+{
+    if (!enabled_) {
+        return true;
+    }
+
+    // cheapest rules first, sampling last so that it only counts rows that
+    // passed everything else
+    auto const accepted = [&]() {
+        if (bsmReceiveTime < rules_.startTime or (rules_.endTime >= 0 and bsmReceiveTime > rules_.endTime)) {
+            return false;
+        }
+        if ((rules_.eeblWarnings or rules_.imaWarnings) and !(rules_.eeblWarnings and eeblWarning) and !(rules_.imaWarnings and imaWarning)) {
+            return false;
+        }
+        if (!rules_.hvIds.empty() and rules_.hvIds.count(hvBsm->getAddress()) == 0) {
+            return false;
+        }
+        if (!rules_.rvIds.empty() and rules_.rvIds.count(rvBsm->getAddress()) == 0) {
+            return false;
+        }
+        if (rules_.attacksOnly and rvBsm->getAttackType() == attack::kAttackNo) {
+            return false;
+        }
+        if (rules_.hasArea) {
+            auto const& pos = hvBsm->getSenderPos();
+            if (pos.x < rules_.minX or pos.x > rules_.maxX or pos.y < rules_.minY or pos.y > rules_.maxY) {
+                return false;
+            }
+        }
+        return rules_.samplingRate >= 1.0 or isSampled(hvBsm->getAddress());
+    }();
+
+    if (!accepted) {
+        ++rejectedCount_;
+    }
+    return accepted;
+}
+
+uint64_t TraceFilter::getRejectedCount() const
+{
+    return rejectedCount_;
+}
+
+bool TraceFilter::isSampled(long const hvId)
+{
+    // keeps row n whenever floor(n * rate) steps up, i.e. exactly rate of the rows
+    auto const n = receivedCounts_[hvId]++;
+    return std::floor((n + 1) * rules_.samplingRate) > std::floor(n * rules_.samplingRate);
+}
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <omnetpp/simtime.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+// forward declarations
+namespace veins {
+class BasicSafetyMessage;
+}
+
+namespace vasp {
+namespace logging {
+
+// a row is traced only if it passes every enabled rule
+struct TraceFilterRules {
+    bool attacksOnly{false}; // attack type other than "Genuine"
+    bool eeblWarnings{false}; // with imaWarnings: the row raised any of the selected warnings
+    bool imaWarnings{false};
+    std::unordered_set<long> hvIds{}; // empty: all
+    std::unordered_set<long> rvIds{}; // empty: all
+    omnetpp::SimTime startTime{}; // receive time window [startTime, endTime]
+    omnetpp::SimTime endTime{-1.0}; // negative: no end
+    bool hasArea{false}; // host vehicle position inside [minX, maxX] x [minY, maxY]
+    double minX{0.0};
+    double minY{0.0};
+    double maxX{0.0};
+    double maxY{0.0};
+    double samplingRate{1.0}; // fraction of the remaining rows kept per receiver
+};
+
+// Decides from the BSMs alone whether a row is traced, so that dropped rows
+// are never copied or formatted. Sampling is deterministic (every
+// 1/samplingRate-th row of a receiver) and does not draw random numbers.
+class TraceFilter final {
+public:
+    TraceFilter() = default;
+    explicit TraceFilter(TraceFilterRules rules);
+
+    bool accepts(
+        veins::BasicSafetyMessage const* rvBsm,
+        veins::BasicSafetyMessage const* hvBsm,
+        omnetpp::SimTime const& bsmReceiveTime,
+        bool const eeblWarning,
+        bool const imaWarning);
+
+    uint64_t getRejectedCount() const;
+
+private:
+    bool isSampled(long const hvId);
+
+private:
+    TraceFilterRules rules_{};
+    bool enabled_{false};
+    std::unordered_map<long, uint64_t> receivedCounts_{};
+    uint64_t rejectedCount_{0};
+};
+
+} // namespace logging
+} // namespace vasp
@@ -26,9 +26,18 @@
  * Email: quic_ransari@quicinc.com
  */
 
-#include <CSVWriter.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <omnetpp/cstringtokenizer.h>
+#include <utility>
 #include <veins/modules/mobility/traci/TraCICommandInterface.h>
+#include <vasp/attack/Registry.h>
+#include <vasp/logging/ColumnarTraceSink.h>
+#include <vasp/logging/CsvTraceSink.h>
+#include <vasp/logging/ShardedTraceSink.h>
 #include <vasp/logging/TraceManager.h>
+#include <vasp/logging/TraceRecord.h>
 #include <vasp/messages/BasicSafetyMessage_m.h>
 
 namespace vasp {
@@ -36,14 +45,172 @@ namespace logging {
 
 Define_Module(TraceManager);
 
+// everything a trace row is filled from; tx and hv-state rows pass their BSM
+// as both rvBsm and hvBsm
+struct TraceSource {
+    veins::BasicSafetyMessage const* rvBsm;
+    veins::BasicSafetyMessage const* hvBsm;
+    omnetpp::simtime_t_cref time; // receive time of rx rows, else the current time
+    bool eeblWarning;
+    bool imaWarning;
+};
+
+namespace {
+// attack_type label, pipelines append the stages that changed the BSM, e.g. "Pipeline:3+66+54"
+void copyAttackType(char (&dst)[kTraceStringSize], veins::BasicSafetyMessage const* bsm)
+{
+    auto const type = bsm->getAttackType();
+    copyTraceString(dst, attack::getRegistration(type).label);
+    if (type != attack::kAttackPipeline) {
+        return;
+    }
+
+    auto length = std::strlen(dst);
+    for (unsigned int i{0}; i < bsm->getAttackStagesArraySize() and length < kTraceStringSize; ++i) {
+        auto const written = std::snprintf(dst + length, kTraceStringSize - length, "%c%d", i == 0 ? ':' : '+', bsm->getAttackStages(i));
+        length += static_cast<std::size_t>(std::max(written, 0));
+    }
+}
+
+// reads one column from the BSMs, in kTraceColumns order
+FillTraceColumn const kFillColumns[kTraceColumnCount]{
+    // columns useful for quick sorting/analysis
+    [](TraceSource const& s, TraceRecord& r) { r.rvId = s.rvBsm->getAddress(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvId = s.hvBsm->getAddress(); },
+    [](TraceSource const& s, TraceRecord& r) { r.targetId = s.rvBsm->getRecipientId(); },
+    [](TraceSource const& s, TraceRecord& r) { r.msgGenerationTime = s.rvBsm->getMsgGenerationTime(); },
+    [](TraceSource const& s, TraceRecord& r) { r.msgReceiveTime = s.time; },
+
+    // remote vehicle columns
+    [](TraceSource const& s, TraceRecord& r) { r.rvMsgCount = s.rvBsm->getMsgCount(); },
+    [](TraceSource const& s, TraceRecord& r) { copyTraceString(r.rvData, s.rvBsm->getGhost() ? "ghost" : s.rvBsm->getData()); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvPosX = s.rvBsm->getSenderPos().x; },
+    [](TraceSource const& s, TraceRecord& r) { r.rvPosY = s.rvBsm->getSenderPos().y; },
+    [](TraceSource const& s, TraceRecord& r) { r.rvPosZ = s.rvBsm->getSenderPos().z; },
+    [](TraceSource const& s, TraceRecord& r) { r.rvSpeed = s.rvBsm->getSenderSpeed().length(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvAccel = s.rvBsm->getAcceleration(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvHeading = s.rvBsm->getHeading().getRad(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvYawRate = s.rvBsm->getYawRate(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvLength = s.rvBsm->getLength(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvWidth = s.rvBsm->getWidth(); },
+    [](TraceSource const& s, TraceRecord& r) { r.rvHeight = s.rvBsm->getHeight(); },
+
+    // host vehicle columns
+    [](TraceSource const& s, TraceRecord& r) { r.hvMsgCount = s.hvBsm->getMsgCount(); },
+    [](TraceSource const& s, TraceRecord& r) { copyTraceString(r.hvData, s.hvBsm->getData()); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvPosX = s.hvBsm->getSenderPos().x; },
+    [](TraceSource const& s, TraceRecord& r) { r.hvPosY = s.hvBsm->getSenderPos().y; },
+    [](TraceSource const& s, TraceRecord& r) { r.hvPosZ = s.hvBsm->getSenderPos().z; },
+    [](TraceSource const& s, TraceRecord& r) { r.hvSpeed = s.hvBsm->getSenderSpeed().length(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvAccel = s.hvBsm->getAcceleration(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvHeading = s.hvBsm->getHeading().getRad(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvLength = s.hvBsm->getLength(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvWidth = s.hvBsm->getWidth(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvHeight = s.hvBsm->getHeight(); },
+
+    // ground truth columns
+    [](TraceSource const& s, TraceRecord& r) { copyAttackType(r.attackType, s.rvBsm); },
+    [](TraceSource const& s, TraceRecord& r) { r.mutatedFields = static_cast<int>(s.rvBsm->getMutatedFields()); },
+
+    // v2x-applications columns
+    [](TraceSource const& s, TraceRecord& r) { r.eeblWarning = s.eeblWarning; },
+    [](TraceSource const& s, TraceRecord& r) { r.imaWarning = s.imaWarning; },
+
+    // normalized trace keys
+    [](TraceSource const& s, TraceRecord& r) { r.txId = s.rvBsm->getTreeId(); },
+    [](TraceSource const& s, TraceRecord& r) { r.hvTime = s.time; },
+};
+
+// columns of the normalized tables: keys are always written, the other
+// columns only if selected
+struct TableColumns {
+    char const* suffix;
+    char const* keys;
+    char const* columns;
+};
+
+TableColumns const kNormalizedTables[kTraceTableCount]{
+    {".rx", "tx_id hv_id msg_rcv_time", "eebl_warn ima_warn"},
+    {".tx", "tx_id rv_id",
+        "target_id msg_generation_time rv_msg_count rv_wsm_data rv_pos_x rv_pos_y rv_pos_z rv_speed rv_accel "
+        "rv_heading rv_yaw_rate rv_length rv_width rv_height attack_type mutated_fields"},
+    {".hv", "hv_id hv_time",
+        "hv_msg_count hv_wsm_data hv_pos_x hv_pos_y hv_pos_z hv_speed hv_accel hv_heading hv_length hv_width hv_height"},
+};
+
+// hands every record to the output of its table
+class TableTraceSink final : public TraceSink {
+public:
+    explicit TableTraceSink(std::vector<TraceSink*> tables)
+        : tables_(std::move(tables))
+    {
+    }
+
+    void writeHeader() override
+    {
+        for (auto* table : tables_) {
+            table->writeHeader();
+        }
+    }
+
+    void write(TraceRecord const& record) override
+    {
+        tables_[record.table]->write(record);
+    }
+
+    void flush() override
+    {
+        for (auto* table : tables_) {
+            table->flush();
+        }
+    }
+
+private:
+    std::vector<TraceSink*> const tables_;
+};
+} // namespace
+
 void TraceManager::initialize(int const stage)
 {
     if (stage == 0) {
         filepath_ = par("filepath").stdstringValue();
+        auto const schema = par("schema").stdstringValue();
+        if (schema != "flat" and schema != "normalized") {
+            throw omnetpp::cRuntimeError("Unknown trace schema: \"%s\"", schema.c_str());
+        }
+        normalized_ = schema == "normalized";
+        format_ = par("format").stdstringValue();
+        rowGroupSize_ = static_cast<std::size_t>(par("rowGroupSize").intValue());
+        if (format_ != "csv" and format_ != "columnar") {
+            throw omnetpp::cRuntimeError("Unknown trace format: \"%s\"", format_.c_str());
+        }
+        initializeFilter();
+        flushInterval_ = par("flushInterval");
     }
 
     if (stage == 1) {
-        writeHeader();
+        ShardingPolicy policy{};
+        policy.partitions = par("shardPartitions").intValue();
+        policy.maxSegmentBytes = static_cast<uint64_t>(par("shardMaxBytes").intValue());
+        policy.maxSegmentRows = static_cast<uint64_t>(par("shardMaxRows").intValue());
+        policy.segmentTimeWindow = par("shardTimeWindow");
+        policy.bufferSize = static_cast<std::size_t>(par("bufferSize").intValue());
+        policy.compression = par("compression").stdstringValue();
+        policy.compressionLevel = par("compressionLevel").intValue();
+        if (policy.partitions < 1) {
+            throw omnetpp::cRuntimeError("shardPartitions must be at least 1");
+        }
+        sharded_ = policy.isSharded();
+        lastFlushTime_ = omnetpp::simTime();
+
+        initializeTables(policy, par("columns").stdstringValue());
+        sink_->writeHeader();
+
+        // from here on only the writer thread touches the sink
+        if (par("asyncWrite").boolValue()) {
+            asyncWriter_.reset(new AsyncTraceWriter(*sink_, static_cast<std::size_t>(par("asyncQueueSize").intValue())));
+            asyncWriter_->start();
+        }
     }
 }
 
@@ -52,6 +219,38 @@ int TraceManager::numInitStages() const
     return std::max(cSimpleModule::numInitStages(), 2);
 }
 
+void TraceManager::finish()
+{
+    recordScalar("traceRowsFiltered", filter_.getRejectedCount());
+
+    if (asyncWriter_) {
+        asyncWriter_->stop();
+        recordScalar("traceQueueFullCount", asyncWriter_->getQueueFullCount());
+    }
+
+    uint64_t segmentCount{0};
+    uint64_t flushCount{0};
+    uint64_t bytesWritten{0};
+    uint64_t uncompressedBytesWritten{0};
+    for (auto& table : tables_) {
+        if (!table.output) {
+            continue;
+        }
+        table.output->close();
+        segmentCount += table.output->getSegmentCount();
+        flushCount += table.output->getFlushCount();
+        bytesWritten += table.output->getBytesWritten();
+        uncompressedBytesWritten += table.output->getUncompressedBytesWritten();
+    }
+
+    if (sharded_) {
+        recordScalar("traceSegmentCount", segmentCount);
+    }
+    recordScalar("traceFlushCount", flushCount);
+    recordScalar("traceBytesWritten", bytesWritten);
+    recordScalar("traceUncompressedBytesWritten", uncompressedBytesWritten);
+}
+
 void TraceManager::logTrace(
     veins::BasicSafetyMessage const* rvBsm,
     veins::BasicSafetyMessage const* hvBsm,
@@ -59,100 +258,180 @@ void TraceManager::logTrace(
     bool const eeblWarning,
     bool const imaWarning)
 {
-    CSVWriter csv{","};
+    if (!filter_.accepts(rvBsm, hvBsm, bsmReceiveTime, eeblWarning, imaWarning)) {
+        return;
+    }
 
-    // clang-format off
-    // columns useful for quick sorting/analysis
-    csv << rvBsm->getAddress()
-        << hvBsm->getAddress()
-        << rvBsm->getRecipientId()
-        << rvBsm->getMsgGenerationTime()
-        << bsmReceiveTime
-
-        // remote vehicle columns
-        << rvBsm->getMsgCount()
-        << rvBsm->getData()
-        << rvBsm->getSenderPos().x
-        << rvBsm->getSenderPos().y
-        << rvBsm->getSenderPos().z
-        << rvBsm->getSenderSpeed().length()
-        << rvBsm->getAcceleration()
-        << rvBsm->getHeading().getRad()
-        << rvBsm->getYawRate()
-        << rvBsm->getLength()
-        << rvBsm->getWidth()
-        << rvBsm->getHeight()
-
-        // host vehicle columns
-        << hvBsm->getMsgCount()
-        << hvBsm->getData()
-        << hvBsm->getSenderPos().x
-        << hvBsm->getSenderPos().y
-        << hvBsm->getSenderPos().z
-        << hvBsm->getSenderSpeed().length()
-        << hvBsm->getAcceleration()
-        << hvBsm->getHeading().getRad()
-        << hvBsm->getLength()
-        << hvBsm->getWidth()
-        << hvBsm->getHeight()
-
-        // ground truth columns
-        << rvBsm->getAttackType()
-
-        // v2x-applications columns
-        << eeblWarning
-        << imaWarning;
-    // clang-format on
-
-    csv.writeToFile(filepath_, true);
+    write(kTraceTableRx, TraceSource{rvBsm, hvBsm, bsmReceiveTime, eeblWarning, imaWarning});
 }
 
-void TraceManager::writeHeader() const noexcept
+void TraceManager::logTransmission(veins::BasicSafetyMessage const* bsm)
 {
-    CSVWriter csv{","};
-
-    // general columns for quick sorting/analysis
-    csv << "rv_id"
-        << "hv_id"
-        << "target_id"
-        << "msg_generation_time"
-        << "msg_rcv_time"
-
-        // remote vehicle columns
-        << "rv_msg_count"
-        << "rv_wsm_data"
-        << "rv_pos_x"
-        << "rv_pos_y"
-        << "rv_pos_z"
-        << "rv_speed"
-        << "rv_accel"
-        << "rv_heading"
-        << "rv_yaw_rate"
-        << "rv_length"
-        << "rv_width"
-        << "rv_height"
-
-        // host vehicle columns
-        << "hv_msg_count"
-        << "hv_wsm_data"
-        << "hv_pos_x"
-        << "hv_pos_y"
-        << "hv_pos_z"
-        << "hv_speed"
-        << "hv_accel"
-        << "hv_heading"
-        << "hv_length"
-        << "hv_width"
-        << "hv_height"
-
-        // ground truth columns
-        << "attack_type"
-
-        // v2x-applications columns
-        << "eebl_warn"
-        << "ima_warn";
-
-    csv.writeToFile(filepath_);
+    if (normalized_) {
+        write(kTraceTableTx, TraceSource{bsm, bsm, omnetpp::simTime(), false, false});
+    }
+}
+
+void TraceManager::logHostState(veins::BasicSafetyMessage const* hvBsm)
+{
+    if (normalized_) {
+        write(kTraceTableHvState, TraceSource{hvBsm, hvBsm, omnetpp::simTime(), false, false});
+    }
+}
+
+void TraceManager::write(TraceTable const table, TraceSource const& source)
+{
+    TraceRecord record{};
+    record.table = table;
+    for (auto const fill : tables_[table].fillPlan) {
+        fill(source, record);
+    }
+
+    if (asyncWriter_) {
+        asyncWriter_->push(record);
+    }
+    else {
+        sink_->write(record);
+    }
+    flushIfDue();
+}
+
+void TraceManager::initializeFilter()
+{
+    TraceFilterRules rules{};
+    rules.attacksOnly = par("filterAttacksOnly").boolValue();
+
+    omnetpp::cStringTokenizer warnings{par("filterWarnings").stringValue()};
+    while (warnings.hasMoreTokens()) {
+        std::string const warning{warnings.nextToken()};
+        if (warning == "eebl") {
+            rules.eeblWarnings = true;
+        }
+        else if (warning == "ima") {
+            rules.imaWarnings = true;
+        }
+        else {
+            throw omnetpp::cRuntimeError("Unknown warning in filterWarnings: \"%s\"", warning.c_str());
+        }
+    }
+
+    for (auto const id : omnetpp::cStringTokenizer{par("filterHvIds").stringValue()}.asIntVector()) {
+        rules.hvIds.insert(id);
+    }
+    for (auto const id : omnetpp::cStringTokenizer{par("filterRvIds").stringValue()}.asIntVector()) {
+        rules.rvIds.insert(id);
+    }
+
+    rules.startTime = par("filterStartTime");
+    rules.endTime = par("filterEndTime");
+
+    auto const area = omnetpp::cStringTokenizer{par("filterArea").stringValue()}.asDoubleVector();
+    if (!area.empty()) {
+        if (area.size() != 4) {
+            throw omnetpp::cRuntimeError("filterArea must be \"minX minY maxX maxY\"");
+        }
+        rules.hasArea = true;
+        rules.minX = area[0];
+        rules.minY = area[1];
+        rules.maxX = area[2];
+        rules.maxY = area[3];
+    }
+
+    rules.samplingRate = par("filterSamplingRate").doubleValue();
+    if (rules.samplingRate <= 0.0 or rules.samplingRate > 1.0) {
+        throw omnetpp::cRuntimeError("filterSamplingRate must be in (0, 1]");
+    }
+
+    filter_ = TraceFilter{std::move(rules)};
+}
+
+void TraceManager::initializeTables(ShardingPolicy const& policy, std::string const& columns)
+{
+    auto const selected = compileTraceColumnPlan(columns);
+    auto const isSelected = [&](std::size_t const column) {
+        return columns.empty() or std::find(selected.begin(), selected.end(), column) != selected.end();
+    };
+
+    if (normalized_) {
+        for (std::size_t i = 0; i < kTraceTableCount; ++i) {
+            auto& table = tables_[i];
+            table.columnPlan = compileTraceColumnPlan(kNormalizedTables[i].keys);
+            for (auto const column : compileTraceColumnPlan(kNormalizedTables[i].columns)) {
+                if (isSelected(column)) {
+                    table.columnPlan.push_back(column);
+                }
+            }
+        }
+    }
+    else {
+        tables_[kTraceTableRx].columnPlan = selected;
+    }
+
+    std::vector<TraceSink*> outputs{};
+    for (std::size_t i = 0; i < kTraceTableCount; ++i) {
+        auto& table = tables_[i];
+        if (table.columnPlan.empty()) {
+            continue;
+        }
+
+        // unselected columns are neither read from the BSMs nor written,
+        // except for the ones the sharded sink routes rows by
+        auto fillColumns = table.columnPlan;
+        if (sharded_) {
+            for (auto const column : compileTraceColumnPlan("rv_id hv_id msg_rcv_time")) {
+                if (std::find(fillColumns.begin(), fillColumns.end(), column) == fillColumns.end()) {
+                    fillColumns.push_back(column);
+                }
+            }
+        }
+        for (auto const column : fillColumns) {
+            table.fillPlan.push_back(kFillColumns[column]);
+        }
+
+        auto const& plan = table.columnPlan;
+        auto const suffix = normalized_ ? kNormalizedTables[i].suffix : "";
+        table.output.reset(new ShardedTraceSink(filepath_, suffix, policy, [this, &plan](BufferedFileWriter& writer) {
+            return createSink(writer, plan);
+        }));
+        outputs.push_back(table.output.get());
+    }
+
+    if (normalized_) {
+        router_.reset(new TableTraceSink(std::move(outputs)));
+        sink_ = router_.get();
+    }
+    else {
+        sink_ = tables_[kTraceTableRx].output.get();
+    }
+}
+
+std::unique_ptr<TraceSink> TraceManager::createSink(BufferedFileWriter& writer, TraceColumnPlan const& plan) const
+{
+    // may run on the async writer thread, so no parameter access here
+    if (format_ == "csv") {
+        return std::unique_ptr<TraceSink>(new CsvTraceSink(writer, plan));
+    }
+    if (format_ == "columnar") {
+        return std::unique_ptr<TraceSink>(new ColumnarTraceSink(writer, rowGroupSize_, plan));
+    }
+    throw omnetpp::cRuntimeError("Unknown trace format: \"%s\"", format_.c_str());
+}
+
+void TraceManager::flushIfDue()
+{
+    // the writer flushes by itself once its buffer is full
+    auto const now = omnetpp::simTime();
+    if (flushInterval_ <= 0 or now - lastFlushTime_ < flushInterval_) {
+        return;
+    }
+
+    if (asyncWriter_) {
+        asyncWriter_->requestFlush();
+    }
+    else {
+        sink_->flush();
+    }
+    lastFlushTime_ = now;
 }
 
 } // namespace logging
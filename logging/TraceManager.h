@@ -28,9 +28,16 @@
 
 #pragma once
 
+#include <memory>
 #include <omnetpp/csimplemodule.h>
 #include <omnetpp/simtime_t.h>
 #include <string>
+#include <vector>
+#include <vasp/logging/AsyncTraceWriter.h>
+#include <vasp/logging/ShardedTraceSink.h>
+#include <vasp/logging/TraceFilter.h>
+#include <vasp/logging/TraceRecord.h>
+#include <vasp/logging/TraceSink.h>
 
 // forward declarations
 namespace veins {
@@ -39,10 +46,14 @@ class BasicSafetyMessage;
 
 namespace vasp {
 namespace logging {
+struct TraceSource;
+using FillTraceColumn = void (*)(TraceSource const&, TraceRecord&);
+
 class TraceManager final : public omnetpp::cSimpleModule {
 public:
     void initialize(int const stage) override;
     int numInitStages() const override;
+    void finish() override;
 
     void logTrace(
         veins::BasicSafetyMessage const* rvBsm,
@@ -51,12 +62,46 @@ public:
         bool const eeblWarning,
         bool const imaWarning);
 
+    // normalized schema only: a BSM as it is sent and the sender's true state
+    // at beacon time; no-ops for the flat schema
+    void logTransmission(veins::BasicSafetyMessage const* bsm);
+    void logHostState(veins::BasicSafetyMessage const* hvBsm);
+
 private:
-    void writeHeader() const noexcept;
+    struct Table {
+        // selected columns, see compileTraceColumnPlan()
+        TraceColumnPlan columnPlan{};
+        std::vector<FillTraceColumn> fillPlan{};
+        std::unique_ptr<ShardedTraceSink> output{nullptr};
+    };
+
+    void initializeFilter();
+    void initializeTables(ShardingPolicy const& policy, std::string const& columns);
+    std::unique_ptr<TraceSink> createSink(BufferedFileWriter& writer, TraceColumnPlan const& plan) const;
+    void write(TraceTable const table, TraceSource const& source);
+    void flushIfDue();
 
 private:
     // Variables to define logging path
     std::string filepath_{};
+    std::string format_{};
+    std::size_t rowGroupSize_{};
+
+    // rows are dropped before they are copied or formatted
+    TraceFilter filter_{};
+
+    // the flat schema only writes the rx table; trace files stay open for the
+    // whole run and are flushed by size or time
+    bool normalized_{false};
+    bool sharded_{false};
+    Table tables_[kTraceTableCount]{};
+    std::unique_ptr<TraceSink> router_{nullptr};
+    TraceSink* sink_{nullptr}; // the rx table's output or router_
+    omnetpp::simtime_t flushInterval_{};
+    omnetpp::simtime_t lastFlushTime_{};
+
+    // optional: rows are formatted and written on a background thread
+    std::unique_ptr<AsyncTraceWriter> asyncWriter_{nullptr};
 };
 } // namespace logging
 } // namespace vasp
@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <omnetpp/cexception.h>
+#include <vasp/logging/TraceRecord.h>
+
+namespace vasp {
+namespace logging {
+
+void copyTraceString(char (&dst)[kTraceStringSize], char const* src)
+{
+    std::strncpy(dst, src, kTraceStringSize - 1);
+    dst[kTraceStringSize - 1] = '\0';
+}
+
+TraceColumn const kTraceColumns[kTraceColumnCount]{
+    // general columns for quick sorting/analysis
+    {"rv_id", kTraceColumnInt64, offsetof(TraceRecord, rvId)},
+    {"hv_id", kTraceColumnInt64, offsetof(TraceRecord, hvId)},
+    {"target_id", kTraceColumnInt64, offsetof(TraceRecord, targetId)},
+    {"msg_generation_time", kTraceColumnFloat64, offsetof(TraceRecord, msgGenerationTime)},
+    {"msg_rcv_time", kTraceColumnSimTime, offsetof(TraceRecord, msgReceiveTime)},
+
+    // remote vehicle columns
+    {"rv_msg_count", kTraceColumnInt32, offsetof(TraceRecord, rvMsgCount)},
+    {"rv_wsm_data", kTraceColumnString, offsetof(TraceRecord, rvData)},
+    {"rv_pos_x", kTraceColumnFloat64, offsetof(TraceRecord, rvPosX)},
+    {"rv_pos_y", kTraceColumnFloat64, offsetof(TraceRecord, rvPosY)},
+    {"rv_pos_z", kTraceColumnFloat64, offsetof(TraceRecord, rvPosZ)},
+    {"rv_speed", kTraceColumnFloat64, offsetof(TraceRecord, rvSpeed)},
+    {"rv_accel", kTraceColumnFloat64, offsetof(TraceRecord, rvAccel)},
+    {"rv_heading", kTraceColumnFloat64, offsetof(TraceRecord, rvHeading)},
+    {"rv_yaw_rate", kTraceColumnFloat64, offsetof(TraceRecord, rvYawRate)},
+    {"rv_length", kTraceColumnFloat64, offsetof(TraceRecord, rvLength)},
+    {"rv_width", kTraceColumnFloat64, offsetof(TraceRecord, rvWidth)},
+    {"rv_height", kTraceColumnFloat64, offsetof(TraceRecord, rvHeight)},
+
+    // host vehicle columns
+    {"hv_msg_count", kTraceColumnInt32, offsetof(TraceRecord, hvMsgCount)},
+    {"hv_wsm_data", kTraceColumnString, offsetof(TraceRecord, hvData)},
+    {"hv_pos_x", kTraceColumnFloat64, offsetof(TraceRecord, hvPosX)},
+    {"hv_pos_y", kTraceColumnFloat64, offsetof(TraceRecord, hvPosY)},
+    {"hv_pos_z", kTraceColumnFloat64, offsetof(TraceRecord, hvPosZ)},
+    {"hv_speed", kTraceColumnFloat64, offsetof(TraceRecord, hvSpeed)},
+    {"hv_accel", kTraceColumnFloat64, offsetof(TraceRecord, hvAccel)},
+    {"hv_heading", kTraceColumnFloat64, offsetof(TraceRecord, hvHeading)},
+    {"hv_length", kTraceColumnFloat64, offsetof(TraceRecord, hvLength)},
+    {"hv_width", kTraceColumnFloat64, offsetof(TraceRecord, hvWidth)},
+    {"hv_height", kTraceColumnFloat64, offsetof(TraceRecord, hvHeight)},
+
+    // ground truth columns
+    {"attack_type", kTraceColumnString, offsetof(TraceRecord, attackType)},
+    {"mutated_fields", kTraceColumnInt32, offsetof(TraceRecord, mutatedFields)},
+
+    // v2x-applications columns
+    {"eebl_warn", kTraceColumnBool, offsetof(TraceRecord, eeblWarning)},
+    {"ima_warn", kTraceColumnBool, offsetof(TraceRecord, imaWarning)},
+
+    // normalized trace keys
+    {"tx_id", kTraceColumnInt64, offsetof(TraceRecord, txId)},
+    {"hv_time", kTraceColumnSimTime, offsetof(TraceRecord, hvTime)},
+};
+
+TraceColumnPlan compileTraceColumnPlan(std::string const& columns)
+{
+    TraceColumnPlan plan{};
+    std::size_t start{0};
+    while ((start = columns.find_first_not_of(" ,", start)) != std::string::npos) {
+        auto const end = std::min(columns.find_first_of(" ,", start), columns.size());
+        auto const name = columns.substr(start, end - start);
+        start = end;
+
+        auto const column = std::find_if(std::begin(kTraceColumns), std::end(kTraceColumns), [&name](TraceColumn const& c) {
+            return name == c.name;
+        });
+        if (column == std::end(kTraceColumns)) {
+            throw omnetpp::cRuntimeError("Unknown trace column: \"%s\"", name.c_str());
+        }
+
+        auto const index = static_cast<std::size_t>(column - std::begin(kTraceColumns));
+        if (std::find(plan.begin(), plan.end(), index) != plan.end()) {
+            throw omnetpp::cRuntimeError("Trace column selected twice: \"%s\"", name.c_str());
+        }
+        plan.push_back(index);
+    }
+
+    if (plan.empty()) {
+        for (std::size_t i = 0; i < kTraceFlatColumnCount; ++i) {
+            plan.push_back(i);
+        }
+    }
+    return plan;
+}
+
+} // namespace logging
+} // namespace vasp
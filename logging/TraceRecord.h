@@ -0,0 +1,133 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <omnetpp/simtime.h>
+#include <string>
+#include <vector>
+
+namespace vasp {
+namespace logging {
+
+std::size_t constexpr kTraceStringSize{48}; // longer strings are truncated
+
+// tables of the normalized trace; the flat trace only has rx rows
+enum TraceTable : uint8_t {
+    kTraceTableRx, // one row per received BSM
+    kTraceTableTx, // one row per transmitted BSM
+    kTraceTableHvState, // one row per vehicle and beacon
+    kTraceTableCount
+};
+
+// One rx trace row captured from the received (remote vehicle) and the host
+// vehicle BSM. Fixed-size so that rows can be queued and formatted later.
+struct TraceRecord {
+    TraceTable table;
+
+    // columns useful for quick sorting/analysis
+    long rvId;
+    long hvId;
+    long targetId;
+    double msgGenerationTime;
+    omnetpp::SimTime msgReceiveTime;
+
+    // remote vehicle columns
+    int rvMsgCount;
+    char rvData[kTraceStringSize];
+    double rvPosX;
+    double rvPosY;
+    double rvPosZ;
+    double rvSpeed;
+    double rvAccel;
+    double rvHeading;
+    double rvYawRate;
+    double rvLength;
+    double rvWidth;
+    double rvHeight;
+
+    // host vehicle columns
+    int hvMsgCount;
+    char hvData[kTraceStringSize];
+    double hvPosX;
+    double hvPosY;
+    double hvPosZ;
+    double hvSpeed;
+    double hvAccel;
+    double hvHeading;
+    double hvLength;
+    double hvWidth;
+    double hvHeight;
+
+    // ground truth columns
+    char attackType[kTraceStringSize];
+    int mutatedFields;
+
+    // v2x-applications columns
+    bool eeblWarning;
+    bool imaWarning;
+
+    // normalized trace keys
+    long txId; // joins rx rows to the tx row of their BSM
+    omnetpp::SimTime hvTime; // time of a hv-state row
+};
+
+void copyTraceString(char (&dst)[kTraceStringSize], char const* src);
+
+enum TraceColumnType : uint8_t {
+    kTraceColumnInt64,
+    kTraceColumnInt32,
+    kTraceColumnFloat64,
+    kTraceColumnSimTime, // raw SimTime ticks
+    kTraceColumnString, // kTraceStringSize chars
+    kTraceColumnBool
+};
+
+struct TraceColumn {
+    char const* name;
+    TraceColumnType type;
+    std::size_t offset; // of the field in TraceRecord
+};
+
+// schema of the rx trace, in output order, followed by the key columns that
+// only the normalized tables use
+std::size_t constexpr kTraceColumnCount{34};
+std::size_t constexpr kTraceFlatColumnCount{32};
+extern TraceColumn const kTraceColumns[kTraceColumnCount];
+
+// indices into kTraceColumns of the columns that are traced, in output order
+using TraceColumnPlan = std::vector<std::size_t>;
+
+// columns: header names separated by spaces or commas; empty selects all
+// columns of the flat trace
+TraceColumnPlan compileTraceColumnPlan(std::string const& columns);
+
+} // namespace logging
+} // namespace vasp
@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+// Microbenchmark of the trace row formatting: CSVWriter (the former row
+// formatting of the trace) against CsvRowEncoder. It first checks that the
+// vendored double formatting round-trips. Only compiled with
+// VASP_BENCHMARK so that it stays out of the simulation library, e.g. from
+// <path/to/veins>/src:
+//
+//   g++ -std=c++14 -O2 -DVASP_BENCHMARK -I. -I$OMNETPP_ROOT/include
+//       vasp/logging/tests/CsvRowEncoderBenchmark.cc vasp/logging/CsvRowEncoder.cc
+//       vasp/logging/TraceRecord.cc -L$OMNETPP_ROOT/lib -loppsim -loppcommon
+//       -o trace_row_benchmark
+//   ./trace_row_benchmark [rows]
+
+#ifdef VASP_BENCHMARK
+
+#include <CSVWriter.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vasp/logging/CsvRowEncoder.h>
+#include <vasp/logging/DoubleToChars.h>
+#include <vasp/logging/TraceRecord.h>
+#include <vector>
+
+using vasp::logging::CsvRowEncoder;
+using vasp::logging::TraceRecord;
+
+namespace {
+std::vector<TraceRecord> makeRecords(std::size_t const count)
+{
+    std::mt19937_64 rng{42};
+    std::uniform_real_distribution<double> position{0.0, 3000.0};
+    std::uniform_real_distribution<double> speed{0.0, 30.0};
+    std::uniform_real_distribution<double> heading{-3.14159, 3.14159};
+
+    std::vector<TraceRecord> records(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& record = records[i];
+        record.rvId = static_cast<long>(rng() % 5000);
+        record.hvId = static_cast<long>(rng() % 5000);
+        record.targetId = -1;
+        record.msgGenerationTime = static_cast<double>(i) * 0.1;
+        record.msgReceiveTime = omnetpp::SimTime(static_cast<double>(i) * 0.1 + 0.000123);
+        record.rvMsgCount = static_cast<int>(i % 128);
+        vasp::logging::copyTraceString(record.rvData, "");
+        record.rvPosX = position(rng);
+        record.rvPosY = position(rng);
+        record.rvSpeed = speed(rng);
+        record.rvAccel = speed(rng) - 15.0;
+        record.rvHeading = heading(rng);
+        record.rvYawRate = heading(rng) / 10.0;
+        record.rvLength = 5.0;
+        record.rvWidth = 1.8;
+        record.rvHeight = 1.5;
+        record.hvMsgCount = static_cast<int>((i + 7) % 128);
+        vasp::logging::copyTraceString(record.hvData, "");
+        record.hvPosX = position(rng);
+        record.hvPosY = position(rng);
+        record.hvSpeed = speed(rng);
+        record.hvAccel = speed(rng) - 15.0;
+        record.hvHeading = heading(rng);
+        record.hvLength = 5.0;
+        record.hvWidth = 1.8;
+        record.hvHeight = 1.5;
+        vasp::logging::copyTraceString(record.attackType, i % 10 == 0 ? "FakeEEBLJustAttack" : "Genuine");
+        record.mutatedFields = i % 10 == 0 ? 135 : 0;
+        record.eeblWarning = i % 3 == 0;
+        record.imaWarning = i % 5 == 0;
+    }
+    return records;
+}
+
+std::size_t formatWithCsvWriter(TraceRecord const& record)
+{
+    CSVWriter csv{","};
+
+    // clang-format off
+    csv << record.rvId << record.hvId << record.targetId << record.msgGenerationTime << record.msgReceiveTime
+        << record.rvMsgCount << record.rvData << record.rvPosX << record.rvPosY << record.rvPosZ
+        << record.rvSpeed << record.rvAccel << record.rvHeading << record.rvYawRate
+        << record.rvLength << record.rvWidth << record.rvHeight
+        << record.hvMsgCount << record.hvData << record.hvPosX << record.hvPosY << record.hvPosZ
+        << record.hvSpeed << record.hvAccel << record.hvHeading
+        << record.hvLength << record.hvWidth << record.hvHeight
+        << record.attackType << record.mutatedFields << record.eeblWarning << record.imaWarning;
+    // clang-format on
+
+    return csv.toString().size() + 1;
+}
+
+// every finite double has to parse back to itself
+bool checkDoubleRoundTrip(std::size_t const count)
+{
+    std::mt19937_64 rng{7};
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) {
+            continue;
+        }
+
+        char buffer[32];
+        *vasp::logging::detail::to_chars(buffer, buffer + 25, value) = '\0';
+        if (std::strtod(buffer, nullptr) != value) {
+            std::printf("round-trip failed: %.17g formatted as %s\n", value, buffer);
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Format>
+void run(char const* name, std::vector<TraceRecord> const& records, Format format)
+{
+    auto const start = std::chrono::steady_clock::now();
+    std::size_t bytes{0};
+    for (auto const& record : records) {
+        bytes += format(record);
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-12s %12.0f rows/s %8.1f MB/s %6.1f bytes/row\n", name, records.size() / elapsed.count(), bytes / elapsed.count() / 1e6, static_cast<double>(bytes) / records.size());
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto const count = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : std::size_t{1000000};
+    if (!checkDoubleRoundTrip(count)) {
+        return 1;
+    }
+    auto const records = makeRecords(count);
+
+    CsvRowEncoder encoder{vasp::logging::compileTraceColumnPlan("")};
+    for (auto round = 0; round < 3; ++round) {
+        run("CSVWriter", records, formatWithCsvWriter);
+        run("CsvRowEncoder", records, [&encoder](TraceRecord const& record) {
+            encoder.encode(record);
+            return encoder.getSize();
+        });
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Layout of a compiled (binary) junction map. The file is a single image that
+// can be mmap'ed and used in place:
+//
+//   MapHeader
+//   Road[roadCount]            sorted by road id (byte-wise)
+//   Junction[junctionCount]
+//   uint32_t slots[slotCount]  open-addressing hash table over roads, see hashRoadId()
+//   uint32_t gridCells[gridColumns * gridRows + 1]
+//                              start of each grid cell's run in gridJunctions
+//   uint32_t gridJunctions[junctionCount]
+//                              junction indices bucketed by grid cell, see getGridCell()
+//   char stringPool[stringPoolSize]
+//
+// All integers and doubles are little-endian and every section starts at an
+// 8-byte aligned offset. tools/compile_junction_map.py writes this format.
+
+namespace vasp {
+namespace map {
+
+struct Junction {
+    double x;
+    double y;
+    double area;
+    uint32_t idOffset; // junction id in the string pool
+    uint32_t idLength;
+};
+
+struct Road {
+    uint32_t idOffset; // road id in the string pool
+    uint32_t idLength;
+    uint32_t junction; // index into the junction table
+};
+
+struct MapHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t roadCount;
+    uint32_t junctionCount;
+    uint32_t slotCount; // power of two
+    uint64_t roadsOffset;
+    uint64_t junctionsOffset;
+    uint64_t slotsOffset;
+    uint64_t stringPoolOffset;
+    uint64_t stringPoolSize;
+    double gridOriginX;
+    double gridOriginY;
+    double gridCellSize;
+    uint32_t gridColumns;
+    uint32_t gridRows;
+    uint64_t gridCellsOffset;
+    uint64_t gridJunctionsOffset;
+};
+
+static_assert(sizeof(Junction) == 32, "unexpected Junction layout");
+static_assert(sizeof(Road) == 12, "unexpected Road layout");
+static_assert(sizeof(MapHeader) == 112, "unexpected MapHeader layout");
+static_assert(std::is_standard_layout<MapHeader>::value, "MapHeader must be standard layout");
+
+char constexpr kMapMagic[8]{'V', 'A', 'S', 'P', 'J', 'M', 'A', 'P'};
+uint32_t constexpr kMapVersion{2};
+uint32_t constexpr kEmptySlot{UINT32_MAX};
+
+inline std::size_t alignSection(std::size_t const offset)
+{
+    return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+// 32-bit FNV-1a; slots are probed linearly starting at hashRoadId() & (slotCount - 1)
+inline uint32_t hashRoadId(char const* id, std::size_t const length)
+{
+    uint32_t hash{2166136261u};
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(id[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// grid column (or row) of a coordinate, coordinates outside the grid are clamped to its border
+// and NaN maps to the first column (or row)
+inline uint32_t getGridIndex(double const value, double const origin, double const cellSize, uint32_t const count)
+{
+    double const index{std::floor((value - origin) / cellSize)};
+    return !(index > 0) ? 0 : index >= count - 1 ? count - 1 : static_cast<uint32_t>(index);
+}
+
+inline uint32_t getGridCell(MapHeader const& header, double const x, double const y)
+{
+    uint32_t const column{getGridIndex(x, header.gridOriginX, header.gridCellSize, header.gridColumns)};
+    uint32_t const row{getGridIndex(y, header.gridOriginY, header.gridCellSize, header.gridRows)};
+    return row * header.gridColumns + column;
+}
+
+} // namespace map
+} // namespace vasp
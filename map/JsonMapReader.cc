@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <omnetpp/cexception.h>
+#include <vasp/map/JsonMapReader.h>
+#include <vasp/map/JunctionMapBuilder.h>
+
+namespace vasp {
+namespace map {
+
+namespace {
+char const* const kArray{"[]"};
+} // namespace
+
+JsonMapReader::JsonMapReader(JunctionMapBuilder& builder)
+    : builder_(builder)
+{
+}
+
+bool JsonMapReader::null()
+{
+    return true;
+}
+
+bool JsonMapReader::boolean(bool)
+{
+    return true;
+}
+
+bool JsonMapReader::number_integer(number_integer_t const val)
+{
+    return number(static_cast<double>(val));
+}
+
+bool JsonMapReader::number_unsigned(number_unsigned_t const val)
+{
+    return number(static_cast<double>(val));
+}
+
+bool JsonMapReader::number_float(number_float_t const val, string_t const&)
+{
+    return number(val);
+}
+
+bool JsonMapReader::string(string_t& val)
+{
+    // roads[].road.id
+    if (path_.size() == 4 and path_[0] == "roads" and path_[2] == "road" and path_[3] == "id") {
+        roadId_ = std::move(val);
+        fields_ |= kFieldRoadId;
+    }
+    else if (isJunctionField("id")) {
+        junctionId_ = std::move(val);
+        fields_ |= kFieldJunctionId;
+    }
+    return true;
+}
+
+bool JsonMapReader::binary(binary_t&)
+{
+    return true;
+}
+
+bool JsonMapReader::start_object(std::size_t)
+{
+    path_.emplace_back();
+    return true;
+}
+
+bool JsonMapReader::key(string_t& val)
+{
+    path_.back() = std::move(val);
+    return true;
+}
+
+bool JsonMapReader::end_object()
+{
+    path_.pop_back();
+
+    // end of a roads[] entry
+    if (path_.size() == 2 and path_[0] == "roads" and path_[1] == kArray) {
+        if (fields_ != kFieldAll) {
+            throw omnetpp::cRuntimeError("Incomplete road entry #%zu in map JSON file", roadCount_);
+        }
+        builder_.addRoad(roadId_, junctionId_, x_, y_, area_);
+        fields_ = 0;
+        ++roadCount_;
+    }
+    return true;
+}
+
+bool JsonMapReader::start_array(std::size_t)
+{
+    path_.emplace_back(kArray);
+    return true;
+}
+
+bool JsonMapReader::end_array()
+{
+    path_.pop_back();
+    return true;
+}
+
+bool JsonMapReader::parse_error(std::size_t const position, std::string const&, nlohmann::detail::exception const& ex)
+{
+    throw omnetpp::cRuntimeError("Unable to parse map JSON file at byte %zu: %s", position, ex.what());
+}
+
+bool JsonMapReader::isJunctionField(char const* field) const
+{
+    // roads[].road.junction.<field>
+    return path_.size() == 5 and path_[0] == "roads" and path_[2] == "road" and path_[3] == "junction" and path_[4] == field;
+}
+
+bool JsonMapReader::number(double const val)
+{
+    if (isJunctionField("x")) {
+        x_ = val;
+        fields_ |= kFieldX;
+    }
+    else if (isJunctionField("y")) {
+        y_ = val;
+        fields_ |= kFieldY;
+    }
+    else if (isJunctionField("area")) {
+        area_ = val;
+        fields_ |= kFieldArea;
+    }
+    return true;
+}
+
+} // namespace map
+} // namespace vasp
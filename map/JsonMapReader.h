@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <json.h>
+#include <string>
+#include <vector>
+
+namespace vasp {
+namespace map {
+class JunctionMapBuilder;
+
+// Streaming (SAX) reader for the JSON junction map schema:
+//   {"roads": [{"road": {"id": ..., "junction": {"id": ..., "area": ..., "x": ..., "y": ...}}}, ...]}
+// Only the fields used by the JunctionMap are kept; every road entry is handed
+// to the builder as soon as it is complete, so no DOM is ever built.
+class JsonMapReader final : public nlohmann::json_sax<nlohmann::json> {
+public:
+    explicit JsonMapReader(JunctionMapBuilder& builder);
+
+    bool null() override;
+    bool boolean(bool val) override;
+    bool number_integer(number_integer_t val) override;
+    bool number_unsigned(number_unsigned_t val) override;
+    bool number_float(number_float_t val, string_t const& s) override;
+    bool string(string_t& val) override;
+    bool binary(binary_t& val) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& val) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, std::string const& lastToken, nlohmann::detail::exception const& ex) override;
+
+private:
+    enum Field : uint8_t {
+        kFieldRoadId = 1 << 0,
+        kFieldJunctionId = 1 << 1,
+        kFieldX = 1 << 2,
+        kFieldY = 1 << 3,
+        kFieldArea = 1 << 4,
+        kFieldAll = (1 << 5) - 1
+    };
+
+    bool isJunctionField(char const* field) const;
+    bool number(double const val);
+
+private:
+    JunctionMapBuilder& builder_;
+    std::vector<std::string> path_{}; // object keys from the root, "[]" for arrays
+
+    // current road entry
+    uint8_t fields_{0};
+    std::string roadId_{};
+    std::string junctionId_{};
+    double x_{};
+    double y_{};
+    double area_{};
+    std::size_t roadCount_{0};
+};
+
+} // namespace map
+} // namespace vasp
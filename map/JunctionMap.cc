@@ -0,0 +1,268 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <omnetpp/cexception.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <veins/base/utils/Coord.h>
+#include <vasp/map/JunctionMap.h>
+
+namespace vasp {
+namespace map {
+
+JunctionMap::JunctionMap(std::vector<char> image)
+    : image_(std::move(image))
+{
+    if (image_.size() < sizeof(MapHeader)) {
+        throw omnetpp::cRuntimeError("Compiled map image is truncated");
+    }
+    attach(image_.data(), image_.size());
+}
+
+JunctionMap::JunctionMap(std::string const& binaryMapFile)
+{
+    int const fd{::open(binaryMapFile.c_str(), O_RDONLY)};
+    if (fd < 0) {
+        throw omnetpp::cRuntimeError("Unable to open compiled map file: \"%s\"", binaryMapFile.c_str());
+    }
+
+    struct stat fileStat {};
+    if (::fstat(fd, &fileStat) != 0 or fileStat.st_size < static_cast<off_t>(sizeof(MapHeader))) {
+        ::close(fd);
+        throw omnetpp::cRuntimeError("Compiled map file is truncated: \"%s\"", binaryMapFile.c_str());
+    }
+
+    mappingSize_ = static_cast<std::size_t>(fileStat.st_size);
+    mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw omnetpp::cRuntimeError("Unable to mmap compiled map file: \"%s\"", binaryMapFile.c_str());
+    }
+
+    try {
+        attach(static_cast<char const*>(mapping_), mappingSize_);
+    }
+    catch (...) {
+        ::munmap(mapping_, mappingSize_);
+        throw;
+    }
+}
+
+JunctionMap::~JunctionMap()
+{
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mappingSize_);
+    }
+}
+
+bool JunctionMap::isBinaryMapFile(std::string const& file)
+{
+    char magic[sizeof(kMapMagic)]{};
+    std::ifstream stream{file, std::ios::binary};
+    stream.read(magic, sizeof(magic));
+    return stream and std::memcmp(magic, kMapMagic, sizeof(kMapMagic)) == 0;
+}
+
+Junction const* JunctionMap::findJunction(std::string const& roadId) const
+{
+    uint32_t const mask{header_->slotCount - 1};
+    for (uint32_t slot = hashRoadId(roadId.data(), roadId.size()) & mask; slots_[slot] != kEmptySlot; slot = (slot + 1) & mask) {
+        auto const& road = roads_[slots_[slot]];
+        if (roadIdEquals(road, roadId.data(), roadId.size())) {
+            return &junctions_[road.junction];
+        }
+    }
+    return nullptr;
+}
+
+template <typename Visitor>
+void JunctionMap::forEachJunctionWithin(veins::Coord const& pos, double const radius, Visitor visit) const
+{
+    // also rejects NaN radii and positions, which have no grid cell
+    if (!(radius >= 0) or !std::isfinite(pos.x) or !std::isfinite(pos.y)) {
+        return;
+    }
+
+    // only the cells overlapping the bounding box of the search circle can hold matches
+    auto const firstColumn = getGridIndex(pos.x - radius, header_->gridOriginX, header_->gridCellSize, header_->gridColumns);
+    auto const lastColumn = getGridIndex(pos.x + radius, header_->gridOriginX, header_->gridCellSize, header_->gridColumns);
+    auto const firstRow = getGridIndex(pos.y - radius, header_->gridOriginY, header_->gridCellSize, header_->gridRows);
+    auto const lastRow = getGridIndex(pos.y + radius, header_->gridOriginY, header_->gridCellSize, header_->gridRows);
+
+    double const squareRadius{radius * radius};
+    for (auto row = firstRow; row <= lastRow; ++row) {
+        for (auto column = firstColumn; column <= lastColumn; ++column) {
+            auto const cell = row * header_->gridColumns + column;
+            for (auto i = gridCells_[cell]; i < gridCells_[cell + 1]; ++i) {
+                auto const& junction = junctions_[gridJunctions_[i]];
+                double const dx{junction.x - pos.x};
+                double const dy{junction.y - pos.y};
+                double const squareDistance{dx * dx + dy * dy};
+                if (squareDistance <= squareRadius) {
+                    visit(junction, squareDistance);
+                }
+            }
+        }
+    }
+}
+
+Junction const* JunctionMap::findNearestJunction(veins::Coord const& pos, double const radius) const
+{
+    Junction const* nearest{nullptr};
+    double nearestSquareDistance{radius * radius};
+    forEachJunctionWithin(pos, radius, [&](Junction const& junction, double const squareDistance) {
+        if (nearest == nullptr or squareDistance < nearestSquareDistance) {
+            nearest = &junction;
+            nearestSquareDistance = squareDistance;
+        }
+    });
+    return nearest;
+}
+
+void JunctionMap::findJunctionsWithin(veins::Coord const& pos, double const radius, std::vector<Junction const*>& junctions) const
+{
+    junctions.clear();
+    forEachJunctionWithin(pos, radius, [&](Junction const& junction, double) {
+        junctions.push_back(&junction);
+    });
+
+    auto const squareDistance = [&pos](Junction const* junction) {
+        return (junction->x - pos.x) * (junction->x - pos.x) + (junction->y - pos.y) * (junction->y - pos.y);
+    };
+    std::sort(junctions.begin(), junctions.end(), [&](Junction const* lhs, Junction const* rhs) {
+        return squareDistance(lhs) < squareDistance(rhs);
+    });
+}
+
+std::string JunctionMap::getJunctionId(Junction const& junction) const
+{
+    return std::string(stringPool_ + junction.idOffset, junction.idLength);
+}
+
+std::size_t JunctionMap::getRoadCount() const
+{
+    return header_->roadCount;
+}
+
+std::size_t JunctionMap::getJunctionCount() const
+{
+    return header_->junctionCount;
+}
+
+void JunctionMap::attach(char const* image, std::size_t const size)
+{
+    header_ = reinterpret_cast<MapHeader const*>(image);
+    if (std::memcmp(header_->magic, kMapMagic, sizeof(kMapMagic)) != 0 or header_->version != kMapVersion) {
+        throw omnetpp::cRuntimeError("Unsupported compiled map format (version %u)", header_->version);
+    }
+
+    // every section has to be aligned and lie within the image, without overflowing the offset arithmetic
+    auto const fits = [size](uint64_t const offset, uint64_t const count, uint64_t const elementSize) {
+        return offset % 8 == 0 and offset <= size and count <= (size - offset) / elementSize;
+    };
+    uint64_t const gridCellCount{uint64_t{header_->gridColumns} * header_->gridRows};
+    bool const valid{header_->slotCount != 0 and (header_->slotCount & (header_->slotCount - 1)) == 0 and
+        fits(header_->roadsOffset, header_->roadCount, sizeof(Road)) and
+        fits(header_->junctionsOffset, header_->junctionCount, sizeof(Junction)) and
+        fits(header_->slotsOffset, header_->slotCount, sizeof(uint32_t)) and
+        std::isfinite(header_->gridOriginX) and std::isfinite(header_->gridOriginY) and
+        std::isfinite(header_->gridCellSize) and header_->gridCellSize > 0 and
+        header_->gridColumns != 0 and header_->gridRows != 0 and gridCellCount < UINT32_MAX and
+        fits(header_->gridCellsOffset, gridCellCount + 1, sizeof(uint32_t)) and
+        fits(header_->gridJunctionsOffset, header_->junctionCount, sizeof(uint32_t)) and
+        fits(header_->stringPoolOffset, header_->stringPoolSize, 1)};
+    if (!valid) {
+        throw omnetpp::cRuntimeError("Corrupt compiled map image");
+    }
+
+    roads_ = reinterpret_cast<Road const*>(image + header_->roadsOffset);
+    junctions_ = reinterpret_cast<Junction const*>(image + header_->junctionsOffset);
+    slots_ = reinterpret_cast<uint32_t const*>(image + header_->slotsOffset);
+    gridCells_ = reinterpret_cast<uint32_t const*>(image + header_->gridCellsOffset);
+    gridJunctions_ = reinterpret_cast<uint32_t const*>(image + header_->gridJunctionsOffset);
+    stringPool_ = image + header_->stringPoolOffset;
+
+    // the entries are trusted by the lookups, so check them once here
+    auto const inStringPool = [this](uint32_t const offset, uint32_t const length) {
+        return uint64_t{offset} + length <= header_->stringPoolSize;
+    };
+    for (uint32_t i = 0; i < header_->roadCount; ++i) {
+        if (roads_[i].junction >= header_->junctionCount or !inStringPool(roads_[i].idOffset, roads_[i].idLength)) {
+            throw omnetpp::cRuntimeError("Corrupt compiled map image: road %u", i);
+        }
+    }
+    for (uint32_t i = 0; i < header_->junctionCount; ++i) {
+        if (!inStringPool(junctions_[i].idOffset, junctions_[i].idLength)) {
+            throw omnetpp::cRuntimeError("Corrupt compiled map image: junction %u", i);
+        }
+    }
+
+    // findJunction() probes until it hits an empty slot
+    bool hasEmptySlot{false};
+    for (uint32_t i = 0; i < header_->slotCount; ++i) {
+        if (slots_[i] == kEmptySlot) {
+            hasEmptySlot = true;
+        }
+        else if (slots_[i] >= header_->roadCount) {
+            throw omnetpp::cRuntimeError("Corrupt compiled map image: hash slot %u", i);
+        }
+    }
+    if (!hasEmptySlot) {
+        throw omnetpp::cRuntimeError("Corrupt compiled map image: hash table has no empty slot");
+    }
+
+    // cell runs have to be ordered and within gridJunctions
+    if (gridCells_[0] != 0 or gridCells_[gridCellCount] > header_->junctionCount) {
+        throw omnetpp::cRuntimeError("Corrupt compiled map image: grid cells");
+    }
+    for (uint64_t i = 0; i < gridCellCount; ++i) {
+        if (gridCells_[i] > gridCells_[i + 1]) {
+            throw omnetpp::cRuntimeError("Corrupt compiled map image: grid cell %u", static_cast<unsigned int>(i));
+        }
+    }
+    for (uint32_t i = 0; i < header_->junctionCount; ++i) {
+        if (gridJunctions_[i] >= header_->junctionCount) {
+            throw omnetpp::cRuntimeError("Corrupt compiled map image: grid junction %u", i);
+        }
+    }
+}
+
+bool JunctionMap::roadIdEquals(Road const& road, char const* id, std::size_t const length) const
+{
+    return road.idLength == length && std::memcmp(stringPool_ + road.idOffset, id, length) == 0;
+}
+
+} // namespace map
+} // namespace vasp
@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <vasp/map/BinaryFormat.h>
+
+namespace veins {
+class Coord;
+} // namespace veins
+
+namespace vasp {
+namespace map {
+
+// Immutable road id -> junction index. The index is a compiled map image (see
+// BinaryFormat.h): either built in memory by the JunctionMapBuilder or mmap'ed
+// from a compiled map file with zero parsing. Roads are looked up through an
+// open-addressing hash table, so a lookup costs one hash and (usually) one
+// string comparison regardless of the map size. Junction positions are
+// bucketed in a uniform grid for radius queries that only visit nearby cells.
+class JunctionMap final {
+public:
+    explicit JunctionMap(std::vector<char> image);
+    explicit JunctionMap(std::string const& binaryMapFile);
+    ~JunctionMap();
+
+    JunctionMap(JunctionMap const&) = delete;
+    JunctionMap& operator=(JunctionMap const&) = delete;
+
+    static bool isBinaryMapFile(std::string const& file);
+
+    // junction at the end of the given road, nullptr if the road is not in the map
+    Junction const* findJunction(std::string const& roadId) const;
+    // nearest junction within radius of the given position, nullptr if there is none
+    Junction const* findNearestJunction(veins::Coord const& pos, double const radius) const;
+    // all junctions within radius of the given position, nearest first
+    void findJunctionsWithin(veins::Coord const& pos, double const radius, std::vector<Junction const*>& junctions) const;
+    std::string getJunctionId(Junction const& junction) const;
+
+    std::size_t getRoadCount() const;
+    std::size_t getJunctionCount() const;
+
+private:
+    void attach(char const* image, std::size_t const size);
+    bool roadIdEquals(Road const& road, char const* id, std::size_t const length) const;
+    template <typename Visitor>
+    void forEachJunctionWithin(veins::Coord const& pos, double const radius, Visitor visit) const;
+
+private:
+    std::vector<char> image_{}; // owned image if built in memory
+    void* mapping_{nullptr}; // mmap'ed image if loaded from a compiled map
+    std::size_t mappingSize_{0};
+
+    MapHeader const* header_{nullptr};
+    Road const* roads_{nullptr};
+    Junction const* junctions_{nullptr};
+    uint32_t const* slots_{nullptr};
+    uint32_t const* gridCells_{nullptr};
+    uint32_t const* gridJunctions_{nullptr};
+    char const* stringPool_{nullptr};
+};
+
+} // namespace map
+} // namespace vasp
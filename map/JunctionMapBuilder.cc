@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vasp/map/JunctionMapBuilder.h>
+
+namespace vasp {
+namespace map {
+
+namespace {
+double constexpr kMinGridCellSize{1.0}; // meters
+} // namespace
+
+void JunctionMapBuilder::addRoad(std::string const& roadId, std::string const& junctionId, double const x, double const y, double const area)
+{
+    auto junctionIt = junctionIndex_.find(junctionId);
+    if (junctionIt == junctionIndex_.end()) {
+        Junction junction{};
+        junction.x = x;
+        junction.y = y;
+        junction.area = area;
+        junction.idOffset = intern(junctionId);
+        junction.idLength = static_cast<uint32_t>(junctionId.size());
+        junctionIt = junctionIndex_.emplace(junctionId, static_cast<uint32_t>(junctions_.size())).first;
+        junctions_.push_back(junction);
+    }
+
+    // the map lists many roads more than once; the last entry of a road wins
+    auto const roadIt = roadIndex_.find(roadId);
+    if (roadIt != roadIndex_.end()) {
+        roads_[roadIt->second].junction = junctionIt->second;
+        return;
+    }
+    roadIndex_.emplace(roadId, static_cast<uint32_t>(roads_.size()));
+    roads_.push_back(Road{intern(roadId), static_cast<uint32_t>(roadId.size()), junctionIt->second});
+}
+
+std::vector<char> JunctionMapBuilder::build() const
+{
+    // sorted road table
+    auto roads = roads_;
+    std::sort(roads.begin(), roads.end(), [this](Road const& lhs, Road const& rhs) {
+        return stringPool_.compare(lhs.idOffset, lhs.idLength, stringPool_, rhs.idOffset, rhs.idLength) < 0;
+    });
+
+    // keep the load factor at or below 0.5 so that probe sequences stay short
+    uint32_t slotCount{1};
+    while (slotCount < 2 * roads.size()) {
+        slotCount <<= 1;
+    }
+    std::vector<uint32_t> slots(slotCount, kEmptySlot);
+    for (uint32_t i = 0; i < roads.size(); ++i) {
+        auto slot = hashRoadId(&stringPool_[roads[i].idOffset], roads[i].idLength) & (slotCount - 1);
+        while (slots[slot] != kEmptySlot) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        slots[slot] = i;
+    }
+
+    MapHeader header{};
+    std::vector<uint32_t> gridCells{};
+    std::vector<uint32_t> gridJunctions{};
+    buildGrid(header, gridCells, gridJunctions);
+
+    std::memcpy(header.magic, kMapMagic, sizeof(kMapMagic));
+    header.version = kMapVersion;
+    header.roadCount = static_cast<uint32_t>(roads.size());
+    header.junctionCount = static_cast<uint32_t>(junctions_.size());
+    header.slotCount = slotCount;
+    header.roadsOffset = alignSection(sizeof(MapHeader));
+    header.junctionsOffset = alignSection(header.roadsOffset + roads.size() * sizeof(Road));
+    header.slotsOffset = alignSection(header.junctionsOffset + junctions_.size() * sizeof(Junction));
+    header.gridCellsOffset = alignSection(header.slotsOffset + slots.size() * sizeof(uint32_t));
+    header.gridJunctionsOffset = alignSection(header.gridCellsOffset + gridCells.size() * sizeof(uint32_t));
+    header.stringPoolOffset = alignSection(header.gridJunctionsOffset + gridJunctions.size() * sizeof(uint32_t));
+    header.stringPoolSize = stringPool_.size();
+
+    std::vector<char> image(header.stringPoolOffset + header.stringPoolSize, 0);
+    std::memcpy(image.data(), &header, sizeof(header));
+    std::memcpy(image.data() + header.roadsOffset, roads.data(), roads.size() * sizeof(Road));
+    std::memcpy(image.data() + header.junctionsOffset, junctions_.data(), junctions_.size() * sizeof(Junction));
+    std::memcpy(image.data() + header.slotsOffset, slots.data(), slots.size() * sizeof(uint32_t));
+    std::memcpy(image.data() + header.gridCellsOffset, gridCells.data(), gridCells.size() * sizeof(uint32_t));
+    std::memcpy(image.data() + header.gridJunctionsOffset, gridJunctions.data(), gridJunctions.size() * sizeof(uint32_t));
+    std::memcpy(image.data() + header.stringPoolOffset, stringPool_.data(), stringPool_.size());
+    return image;
+}
+
+void JunctionMapBuilder::buildGrid(MapHeader& header, std::vector<uint32_t>& cells, std::vector<uint32_t>& cellJunctions) const
+{
+    header.gridOriginX = 0;
+    header.gridOriginY = 0;
+    header.gridCellSize = kMinGridCellSize;
+    header.gridColumns = 1;
+    header.gridRows = 1;
+
+    if (!junctions_.empty()) {
+        double maxX{junctions_.front().x};
+        double maxY{junctions_.front().y};
+        header.gridOriginX = junctions_.front().x;
+        header.gridOriginY = junctions_.front().y;
+        for (auto const& junction : junctions_) {
+            header.gridOriginX = std::min(header.gridOriginX, junction.x);
+            header.gridOriginY = std::min(header.gridOriginY, junction.y);
+            maxX = std::max(maxX, junction.x);
+            maxY = std::max(maxY, junction.y);
+        }
+
+        // size cells so that a cell holds about one junction on average
+        double const width{std::max(maxX - header.gridOriginX, kMinGridCellSize)};
+        double const height{std::max(maxY - header.gridOriginY, kMinGridCellSize)};
+        header.gridCellSize = std::max(std::sqrt(width * height / junctions_.size()), kMinGridCellSize);
+        header.gridColumns = static_cast<uint32_t>(std::floor(width / header.gridCellSize)) + 1;
+        header.gridRows = static_cast<uint32_t>(std::floor(height / header.gridCellSize)) + 1;
+    }
+
+    // bucket junctions by cell (counting sort), cells[c] .. cells[c + 1] is the run of cell c
+    std::vector<uint32_t> junctionCells(junctions_.size());
+    cells.assign(header.gridColumns * header.gridRows + 1, 0);
+    for (uint32_t i = 0; i < junctions_.size(); ++i) {
+        junctionCells[i] = getGridCell(header, junctions_[i].x, junctions_[i].y);
+        ++cells[junctionCells[i] + 1];
+    }
+    for (std::size_t cell = 1; cell < cells.size(); ++cell) {
+        cells[cell] += cells[cell - 1];
+    }
+    auto next = cells;
+    cellJunctions.assign(junctions_.size(), 0);
+    for (uint32_t i = 0; i < junctions_.size(); ++i) {
+        cellJunctions[next[junctionCells[i]]++] = i;
+    }
+}
+
+uint32_t JunctionMapBuilder::intern(std::string const& str)
+{
+    auto const offset{static_cast<uint32_t>(stringPool_.size())};
+    stringPool_ += str;
+    return offset;
+}
+
+} // namespace map
+} // namespace vasp
@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <vasp/map/BinaryFormat.h>
+
+namespace vasp {
+namespace map {
+
+// Collects road -> junction entries and lays them out as a compiled map image
+// (see BinaryFormat.h). Duplicate road entries are collapsed; the last entry
+// of a road wins.
+class JunctionMapBuilder final {
+public:
+    void addRoad(std::string const& roadId, std::string const& junctionId, double const x, double const y, double const area);
+    std::vector<char> build() const;
+
+private:
+    void buildGrid(MapHeader& header, std::vector<uint32_t>& cells, std::vector<uint32_t>& cellJunctions) const;
+    uint32_t intern(std::string const& str);
+
+private:
+    std::string stringPool_{};
+    std::vector<Junction> junctions_{};
+    std::vector<Road> roads_{};
+    std::unordered_map<std::string, uint32_t> junctionIndex_{};
+    std::unordered_map<std::string, uint32_t> roadIndex_{};
+};
+
+} // namespace map
+} // namespace vasp
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Project: V2X Application Spoofing Platform (VASP)
+ * Author: Raashid Ansari
+ * Email: quic_ransari@quicinc.com
+ */
+
+#include <fstream>
+#include <omnetpp.h>
+#include <vasp/map/JsonMapReader.h>
+#include <vasp/map/JunctionMapBuilder.h>
+#include <vasp/map/MapManager.h>
+
+namespace vasp {
+namespace map {
+
+Define_Module(MapManager);
+
+void MapManager::initialize(int const stage)
+{
+    if (stage == 0) {
+        mapFile_ = par("mapFile").stdstringValue();
+        loadMap();
+    }
+}
+
+std::shared_ptr<JunctionMap const> MapManager::getMap() const
+{
+    return map_;
+}
+
+void MapManager::loadMap()
+{
+    // compiled maps are used in place, JSON maps are indexed once here
+    if (JunctionMap::isBinaryMapFile(mapFile_)) {
+        map_ = std::make_shared<JunctionMap>(mapFile_);
+    }
+    else {
+        map_ = std::make_shared<JunctionMap>(readJsonMap());
+    }
+    EV_INFO << "Loaded " << map_->getRoadCount() << " roads leading to " << map_->getJunctionCount()
+            << " junctions from \"" << mapFile_ << "\"" << std::endl;
+}
+
+std::vector<char> MapManager::readJsonMap() const
+{
+    std::ifstream mapFileStream{mapFile_};
+    if (!mapFileStream) {
+        std::string errorMsg = "Unable to open map JSON file: \"" + mapFile_ + "\"";
+        throw omnetpp::cRuntimeError(errorMsg.c_str());
+    }
+
+    // stream the file straight into the builder, the JSON document is never held in memory
+    JunctionMapBuilder builder{};
+    JsonMapReader reader{builder};
+    nlohmann::json::sax_parse(mapFileStream, &reader);
+    return builder.build();
+}
+
+} // namespace map
+} // namespace vasp
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+#
+# MIT License
+#
+# Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+# of the Software, and to permit persons to whom the Software is furnished to do
+# so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Project: V2X Application Spoofing Platform (VASP)
+# Author: Raashid Ansari
+# Email: quic_ransari@quicinc.com
+#
+
+"""
+Compiles a junction map from the JSON schema used by scenario/*.junctions.json
+into the binary format described in map/BinaryFormat.h. The compiled map can
+be used as the mapManager's mapFile and is mmap'ed without any parsing.
+
+usage: compile_junction_map.py <map.junctions.json> <map.junctions.bin>
+"""
+
+import json
+import math
+import struct
+import sys
+
+MAGIC = b"VASPJMAP"
+VERSION = 2
+EMPTY_SLOT = 0xFFFFFFFF
+MIN_GRID_CELL_SIZE = 1.0
+
+HEADER = struct.Struct("<8sIIIIQQQQQdddIIQQ")
+ROAD = struct.Struct("<III")
+JUNCTION = struct.Struct("<dddII")
+
+
+def align(offset):
+    return (offset + 7) & ~7
+
+
+def hash_road_id(road_id):
+    # 32-bit FNV-1a, must match hashRoadId() in map/BinaryFormat.h
+    value = 2166136261
+    for byte in road_id:
+        value ^= byte
+        value = (value * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def grid_index(value, origin, cell_size, count):
+    # must match getGridIndex() in map/BinaryFormat.h
+    index = math.floor((value - origin) / cell_size)
+    return 0 if index <= 0 else count - 1 if index >= count - 1 else int(index)
+
+
+def build_grid(junctions):
+    origin_x, origin_y, cell_size, columns, rows = 0.0, 0.0, MIN_GRID_CELL_SIZE, 1, 1
+    if junctions:
+        origin_x = min(junction[0] for junction in junctions)
+        origin_y = min(junction[1] for junction in junctions)
+        # size cells so that a cell holds about one junction on average
+        width = max(max(junction[0] for junction in junctions) - origin_x, MIN_GRID_CELL_SIZE)
+        height = max(max(junction[1] for junction in junctions) - origin_y, MIN_GRID_CELL_SIZE)
+        cell_size = max(math.sqrt(width * height / len(junctions)), MIN_GRID_CELL_SIZE)
+        columns = math.floor(width / cell_size) + 1
+        rows = math.floor(height / cell_size) + 1
+
+    buckets = [[] for _ in range(columns * rows)]
+    for index, junction in enumerate(junctions):
+        column = grid_index(junction[0], origin_x, cell_size, columns)
+        row = grid_index(junction[1], origin_y, cell_size, rows)
+        buckets[row * columns + column].append(index)
+
+    cells = [0]
+    for bucket in buckets:
+        cells.append(cells[-1] + len(bucket))
+    cell_junctions = [index for bucket in buckets for index in bucket]
+    return (origin_x, origin_y, cell_size, columns, rows), cells, cell_junctions
+
+
+def compile_map(map_json):
+    string_pool = bytearray()
+    junctions = []
+    junction_index = {}
+    roads = {}
+
+    def intern(text):
+        offset = len(string_pool)
+        string_pool.extend(text)
+        return offset, len(text)
+
+    for road_obj in map_json["roads"]:
+        road = road_obj["road"]
+        junction = road["junction"]
+
+        junction_id = junction["id"].encode()
+        if junction_id not in junction_index:
+            junction_index[junction_id] = len(junctions)
+            junctions.append((junction["x"], junction["y"], junction["area"]) + intern(junction_id))
+
+        # the map lists many roads more than once; the last entry of a road wins
+        road_id = road["id"].encode()
+        roads[road_id] = junction_index[junction_id]
+
+    road_table = []
+    for road_id in sorted(roads):
+        road_table.append(intern(road_id) + (roads[road_id],))
+
+    slot_count = 1
+    while slot_count < 2 * len(road_table):
+        slot_count <<= 1
+    slots = [EMPTY_SLOT] * slot_count
+    for index, (offset, length, _) in enumerate(road_table):
+        slot = hash_road_id(string_pool[offset:offset + length]) & (slot_count - 1)
+        while slots[slot] != EMPTY_SLOT:
+            slot = (slot + 1) & (slot_count - 1)
+        slots[slot] = index
+
+    grid, grid_cells, grid_junctions = build_grid(junctions)
+
+    roads_offset = align(HEADER.size)
+    junctions_offset = align(roads_offset + len(road_table) * ROAD.size)
+    slots_offset = align(junctions_offset + len(junctions) * JUNCTION.size)
+    grid_cells_offset = align(slots_offset + slot_count * 4)
+    grid_junctions_offset = align(grid_cells_offset + len(grid_cells) * 4)
+    string_pool_offset = align(grid_junctions_offset + len(grid_junctions) * 4)
+
+    image = bytearray(string_pool_offset + len(string_pool))
+    HEADER.pack_into(image, 0, MAGIC, VERSION, len(road_table), len(junctions), slot_count,
+                     roads_offset, junctions_offset, slots_offset, string_pool_offset, len(string_pool),
+                     *grid, grid_cells_offset, grid_junctions_offset)
+    for index, road in enumerate(road_table):
+        ROAD.pack_into(image, roads_offset + index * ROAD.size, *road)
+    for index, junction in enumerate(junctions):
+        JUNCTION.pack_into(image, junctions_offset + index * JUNCTION.size, *junction)
+    struct.pack_into("<%dI" % slot_count, image, slots_offset, *slots)
+    struct.pack_into("<%dI" % len(grid_cells), image, grid_cells_offset, *grid_cells)
+    struct.pack_into("<%dI" % len(grid_junctions), image, grid_junctions_offset, *grid_junctions)
+    image[string_pool_offset:] = string_pool
+    return bytes(image)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    with open(sys.argv[1]) as json_file:
+        image = compile_map(json.load(json_file))
+    with open(sys.argv[2], "wb") as bin_file:
+        bin_file.write(image)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+
+#
+# MIT License
+#
+# Copyright (c) 2022 Qualcomm Innovation Center, Inc., SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+# of the Software, and to permit persons to whom the Software is furnished to do
+# so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Project: V2X Application Spoofing Platform (VASP)
+# Author: Raashid Ansari
+# Email: quic_ransari@quicinc.com
+#
+
+
+"""
+Converts a trace written with the TraceManager's format = "columnar" (see
+logging/ColumnarTraceSink.h) into the CSV layout explained in
+docs/trace_file_column_explanation.md. Receive times are printed exactly from
+their raw SimTime ticks; booleans are printed as 1/0 like the CSV sink does. Traces written with
+compression = "gzip" are read directly; decompress "zstd" traces first.
+
+usage: trace_to_csv.py <trace.bin> <trace.csv>
+"""
+
+import csv
+import gzip
+import struct
+import sys
+
+MAGIC = b"VASPTRCB"
+VERSION = 1
+
+# TraceColumnType in logging/TraceRecord.h: (struct format, width)
+COLUMN_TYPES = {
+    0: ("q", 8),  # int64
+    1: ("i", 4),  # int32
+    2: ("d", 8),  # float64
+    3: ("q", 8),  # SimTime raw ticks
+    4: ("I", 4),  # string dictionary code
+    5: ("B", 1),  # bool
+}
+SIMTIME_TYPE = 3
+STRING_TYPE = 4
+BOOL_TYPE = 5
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def at_end(self):
+        return self.pos >= len(self.data)
+
+    def read(self, size):
+        if self.pos + size > len(self.data):
+            raise ValueError("truncated trace file")
+        chunk = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return chunk
+
+    def unpack(self, fmt):
+        fmt = "<" + fmt
+        return struct.unpack(fmt, self.read(struct.calcsize(fmt)))
+
+
+def format_simtime(ticks, scale_exponent):
+    sign = "-" if ticks < 0 else ""
+    digits = str(abs(ticks)).rjust(-scale_exponent + 1, "0")
+    integer, fraction = digits[:scale_exponent], digits[scale_exponent:].rstrip("0")
+    return sign + integer + ("." + fraction if fraction else "")
+
+
+def format_value(column_type, value, dictionary, scale_exponent):
+    if column_type == SIMTIME_TYPE:
+        return format_simtime(value, scale_exponent)
+    if column_type == STRING_TYPE:
+        return dictionary[value]
+    if column_type == BOOL_TYPE:
+        return "1" if value else "0"
+    if isinstance(value, float):
+        # shortest round-trip repr, without the ".0" the CSV sink never prints
+        text = repr(value)
+        return text[:-2] if text.endswith(".0") else text
+    return str(value)
+
+
+def convert(trace_file, csv_file):
+    with open(trace_file, "rb") as f:
+        data = f.read()
+    if data[:2] == b"\x1f\x8b":
+        data = gzip.decompress(data)
+    reader = Reader(data)
+
+    if reader.read(len(MAGIC)) != MAGIC:
+        raise ValueError("not a columnar trace file: " + trace_file)
+    version, scale_exponent, column_count = reader.unpack("Iii")
+    if version != VERSION:
+        raise ValueError("unsupported trace version %d" % version)
+
+    names, types = [], []
+    for _ in range(column_count):
+        column_type, name_length = reader.unpack("BB")
+        types.append(column_type)
+        names.append(reader.read(name_length).decode())
+
+    dictionary = []
+    with open(csv_file, "w", newline="") as out:
+        writer = csv.writer(out, lineterminator="\n")
+        writer.writerow(names)
+        while not reader.at_end():
+            block = reader.read(1)
+            if block == b"D":
+                (count,) = reader.unpack("I")
+                for _ in range(count):
+                    (length,) = reader.unpack("I")
+                    dictionary.append(reader.read(length).decode())
+            elif block == b"R":
+                (rows,) = reader.unpack("I")
+                columns = []
+                for column_type in types:
+                    fmt, width = COLUMN_TYPES[column_type]
+                    values = struct.unpack("<%d%s" % (rows, fmt), reader.read(rows * width))
+                    columns.append([format_value(column_type, v, dictionary, scale_exponent) for v in values])
+                writer.writerows(zip(*columns))
+            else:
+                raise ValueError("unknown block type %r at offset %d" % (block, reader.pos - 1))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    convert(sys.argv[1], sys.argv[2])
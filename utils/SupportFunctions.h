@@ -131,11 +131,9 @@ inline double getSafetyDistance(veins::Coord const& speed)
     return distanceTraveledBetweenPerceptionToReaction + distanceTraveledDuringBraking;
 }
 
-inline veins::Coord getPosOffset(veins::BasicSafetyMessage const* rvBsm, double const& offset)
+inline veins::Coord getPosOffset(veins::Coord const& pos, veins::Heading const& heading, double const& offset)
 {
-    veins::Coord const heading{rvBsm->getHeading().toCoord()};
-    veins::Coord const pos{rvBsm->getSenderPos()};
-    return pos + heading * offset; // equivalent to return attacker_pos + (distance + attacker_pos.distance(target_pos)) * u;
+    return pos + heading.toCoord() * offset; // equivalent to return attacker_pos + (distance + attacker_pos.distance(target_pos)) * u;
 }
 
 } // namespace utils